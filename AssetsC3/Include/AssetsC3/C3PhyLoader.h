@@ -2,6 +2,7 @@
 
 #include <Core/Math/Math.h>
 #include <cstdint>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
@@ -62,8 +63,24 @@ struct DivInfo {
  * @brief Single keyframe data
  */
 struct C3Keyframe {
-  uint32_t framePosition = 0;     // Frame index
-  std::vector<mat4> boneMatrices; // Bone transformations
+  using allocator_type = std::pmr::polymorphic_allocator<>;
+
+  uint32_t framePosition = 0;          // Frame index
+  std::pmr::vector<mat4> boneMatrices; // Bone transformations
+
+  // Allocator-aware, so a pmr vector of keyframes passes its resource on
+  C3Keyframe() = default;
+  explicit C3Keyframe(const allocator_type &alloc) : boneMatrices(alloc) {}
+  C3Keyframe(const C3Keyframe &other, const allocator_type &alloc)
+      : framePosition(other.framePosition),
+        boneMatrices(other.boneMatrices, alloc) {}
+  C3Keyframe(C3Keyframe &&other, const allocator_type &alloc)
+      : framePosition(other.framePosition),
+        boneMatrices(std::move(other.boneMatrices), alloc) {}
+  C3Keyframe(const C3Keyframe &) = default;
+  C3Keyframe(C3Keyframe &&) = default;
+  C3Keyframe &operator=(const C3Keyframe &) = default;
+  C3Keyframe &operator=(C3Keyframe &&) = default;
 };
 
 /**
@@ -75,18 +92,20 @@ struct C3Motion {
   uint32_t keyframeCount;  // Number of keyframes
   C3KeyframeFormat format; // Keyframe format
 
-  std::vector<C3Keyframe> keyframes; // Keyframe data
-  std::vector<mat4> currentBones;    // Current bone matrices (interpolated)
+  std::pmr::vector<C3Keyframe> keyframes; // Keyframe data
+  std::vector<mat4> currentBones; // Current bone matrices (interpolated)
 
   // Morph target data
-  uint32_t morphCount;             // Number of morph targets
-  std::vector<float> morphWeights; // [morphCount * frameCount]
+  uint32_t morphCount;                  // Number of morph targets
+  std::pmr::vector<float> morphWeights; // [morphCount * frameCount]
 
   int currentFrame; // Current playback frame
 
-  C3Motion()
+  explicit C3Motion(
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource())
       : boneCount(0), frameCount(0), keyframeCount(0),
-        format(C3KeyframeFormat::Legacy), morphCount(0), currentFrame(0) {}
+        format(C3KeyframeFormat::Legacy), keyframes(resource), morphCount(0),
+        morphWeights(resource), currentFrame(0) {}
 };
 
 /**
@@ -120,12 +139,12 @@ struct C3Phy {
   // Vertex data
   uint32_t normalVertexCount;      // Opaque vertices
   uint32_t alphaVertexCount;       // Transparent vertices
-  std::vector<PhyVertex> vertices; // All vertices
+  std::pmr::vector<PhyVertex> vertices; // All vertices
 
   // Index data
   uint32_t normalTriCount;       // Opaque triangles
   uint32_t alphaTriCount;        // Transparent triangles
-  std::vector<uint16_t> indices; // All indices
+  std::pmr::vector<uint16_t> indices; // All indices
 
   // Texture data
   std::string textureName;  // Primary texture
@@ -143,12 +162,22 @@ struct C3Phy {
   bool shouldDraw;
 
   // Inverse Bind Pose Matrices (calculated from Frame 0)
-  std::vector<mat4> invBindMatrices;
+  std::pmr::vector<mat4> invBindMatrices;
 
-  C3Phy()
+  /**
+   * @param resource Memory for the mesh and animation data (e.g. an asset
+   * TLSFAllocator); must outlive the C3Phy
+   */
+  explicit C3Phy(
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource())
       : blendCount(0), normalVertexCount(0), alphaVertexCount(0),
-        normalTriCount(0), alphaTriCount(0), uvAnimStep(0.0f), textureRows(1),
-        color(1.0f), motion(nullptr), shouldDraw(true) {}
+        vertices(resource), normalTriCount(0), alphaTriCount(0),
+        indices(resource), uvAnimStep(0.0f), textureRows(1), color(1.0f),
+        motion(nullptr), shouldDraw(true), invBindMatrices(resource) {}
+
+  std::pmr::memory_resource *GetMemoryResource() const {
+    return vertices.get_allocator().resource();
+  }
 
   ~C3Phy() {
     if (motion) {
@@ -1,5 +1,6 @@
 ﻿#include "AssetsC3/C3PhyLoader.h"
 #include "Core/Logging/Logger.h"
+#include "Core/Memory/StackAllocator.h"
 #include <algorithm>
 #include <cstring>
 #include <fstream>
@@ -49,7 +50,9 @@ bool C3PhyLoader::Load(const std::string &filepath, C3Phy &outPhy) {
   size_t fileSize = static_cast<size_t>(file.tellg());
   file.seekg(0, std::ios::beg);
 
-  std::vector<uint8_t> buffer(fileSize);
+  // Only needed while parsing; large files spill from the thread stack to the heap
+  StackScope scratch;
+  std::pmr::vector<uint8_t> buffer(fileSize, scratch.GetResource());
   if (!file.read(reinterpret_cast<char *>(buffer.data()), fileSize)) {
     YAMEN_CORE_ERROR("C3PhyLoader: Failed to read file: {}", filepath);
     return false;
@@ -99,7 +102,7 @@ bool C3PhyLoader::LoadFromMemory(const uint8_t *data, size_t size,
         YAMEN_CORE_INFO("C3PhyLoader: Loading main skeleton from {}",
                         std::string(chunkID, 4));
         if (!outPhy.motion)
-          outPhy.motion = new C3Motion();
+          outPhy.motion = new C3Motion(outPhy.GetMemoryResource());
         if (!ParseMotionChunk(data, offset, size, *outPhy.motion))
           return false;
         firstMotionLoaded = true;
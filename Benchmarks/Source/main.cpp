@@ -0,0 +1,86 @@
+#include <Core/Logging/Logger.h>
+#include <Tools/Benchmarks/SimdMathBenchmark.h>
+#include <Tools/Benchmarks/TaskSubmissionBenchmark.h>
+#include <Tools/Benchmarks/ThreadPoolBenchmark.h>
+#include <Tools/Benchmarks/TransformHierarchyBenchmark.h>
+#include <Tools/Benchmarks/XPBDBroadPhaseBenchmark.h>
+#include <Tools/Benchmarks/XPBDParticleStoreBenchmark.h>
+#include <algorithm>
+#include <exception>
+#include <string_view>
+
+// Runs the Tools benchmarks and logs their tables. Pass benchmark names to run
+// only those; with none, all run. Exits non-zero if a benchmark's result check
+// fails, so a build step can run it after the libraries change.
+//
+//   Benchmarks [threadpool] [tasks] [simd] [transform] [broadphase] [particlestore]
+
+namespace {
+
+    bool Selected(int argc, char** argv, std::string_view name) {
+        if (argc < 2) {
+            return true;
+        }
+        for (int i = 1; i < argc; ++i) {
+            if (name == argv[i]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    using namespace Yamen;
+
+    Core::Logger::Initialize("Benchmarks.log");
+    bool passed = true;
+
+    try {
+        if (Selected(argc, argv, "threadpool")) {
+            Tools::LogThreadPoolBenchmarkResults(Tools::RunThreadPoolContentionBenchmark());
+        }
+
+        if (Selected(argc, argv, "tasks")) {
+            Tools::LogTaskSubmissionBenchmarkResults(Tools::RunTaskSubmissionBenchmark());
+        }
+
+        if (Selected(argc, argv, "simd")) {
+            Tools::LogSimdMathBenchmarkResults(Tools::RunSimdMathBenchmark());
+        }
+
+        if (Selected(argc, argv, "transform")) {
+            Tools::LogTransformHierarchyBenchmarkResults(Tools::RunTransformHierarchyBenchmark());
+        }
+
+        if (Selected(argc, argv, "broadphase")) {
+            // The all-pairs reference only at the small count; it is O(N^2)
+            Tools::XPBDBroadPhaseBenchmarkConfig config;
+            config.allPairsMaxCount = 1000;
+
+            const auto results = Tools::RunXPBDBroadPhaseBenchmark(config);
+            Tools::LogXPBDBroadPhaseBenchmarkResults(results);
+            if (!std::all_of(results.begin(), results.end(), [](const auto& r) { return r.matchesAllPairs; })) {
+                YAMEN_CORE_ERROR("XPBD broad phase: spatial hash contacts differ from all pairs");
+                passed = false;
+            }
+        }
+
+        if (Selected(argc, argv, "particlestore")) {
+            const auto results = Tools::RunXPBDParticleStoreBenchmark();
+            Tools::LogXPBDParticleStoreBenchmarkResults(results);
+            if (!std::all_of(results.begin(), results.end(), [](const auto& r) { return r.matchesComponents; })) {
+                YAMEN_CORE_ERROR("XPBD particle store: results differ from the component path");
+                passed = false;
+            }
+        }
+    }
+    catch (const std::exception& e) {
+        YAMEN_CORE_CRITICAL("Benchmark failed: {}", e.what());
+        passed = false;
+    }
+
+    Core::Logger::Shutdown();
+    return passed ? 0 : 1;
+}
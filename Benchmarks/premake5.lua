@@ -0,0 +1,56 @@
+project "Benchmarks"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++latest"
+    staticruntime "off"
+    
+    targetdir ("../bin/" .. outputdir .. "/%{prj.name}")
+    objdir ("../bin-int/" .. outputdir .. "/%{prj.name}")
+    
+    files {
+        "Source/**.cpp"
+    }
+    
+    includedirs {
+        "../Tools/Include",
+        "../EngineCore/Include",
+        "%{IncludeDirs.spdlog}",
+        "%{IncludeDirs.fmt}"
+    }
+    
+    links {
+        "Tools",
+        "ECS",
+        "Graphics",
+        "Platform",
+        "EngineCore",
+        "ImGui",
+        "fmt"
+    }
+    
+    filter "system:windows"
+        systemversion "latest"
+        defines {
+            "PLATFORM_WINDOWS",
+            "WIN32_LEAN_AND_MEAN",
+            "NOMINMAX",
+            "SPDLOG_FMT_EXTERNAL"
+        }
+    
+    filter "configurations:Debug"
+        defines { "DEBUG", "_DEBUG" }
+        runtime "Debug"
+        symbols "on"
+        optimize "off"
+    
+    filter "configurations:Release"
+        defines { "NDEBUG" }
+        runtime "Release"
+        optimize "on"
+        symbols "on"
+    
+    filter "configurations:Dist"
+        defines { "NDEBUG", "DIST" }
+        runtime "Release"
+        optimize "full"
+        symbols "off"
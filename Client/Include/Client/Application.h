@@ -7,6 +7,9 @@
 #include "Graphics/RHI/GraphicsDevice.h"
 #include "Graphics/RHI/SwapChain.h"
 #include "Client/EngineConfig.h"
+#include <Core/Memory/FrameAllocator.h>
+#include <Core/Memory/TLSFAllocator.h>
+#include <Core/Threading/ThreadPool.h>
 #include <memory>
 
 namespace Yamen::Client {
@@ -70,9 +73,28 @@ namespace Yamen::Client {
          */
         Platform::EventDispatcher& GetEventDispatcher() { return m_EventDispatcher; }
 
+        /**
+         * @brief Get per-frame scratch memory (valid for this frame and the next)
+         */
+        Core::FrameAllocator& GetFrameAllocator() { return m_FrameAllocator; }
+
+        /**
+         * @brief Get the fixed-budget pool for loaded asset data
+         */
+        Core::TLSFAllocator& GetAssetAllocator() { return *m_AssetAllocator; }
+
+        /**
+         * @brief Get the worker pool scenes run their systems on
+         */
+        Core::ThreadPool& GetThreadPool() { return *m_ThreadPool; }
+
     private:
         void OnEvent(Platform::Event& event);
 
+        // Declared first so they outlive the scenes whose containers point into them
+        Core::FrameAllocator m_FrameAllocator;
+        std::unique_ptr<Core::TLSFAllocator> m_AssetAllocator;
+        std::unique_ptr<Core::ThreadPool> m_ThreadPool;
         std::unique_ptr<Platform::Window> m_Window;
         std::unique_ptr<Graphics::GraphicsDevice> m_GraphicsDevice;
         std::unique_ptr<Graphics::SwapChain> m_SwapChain;
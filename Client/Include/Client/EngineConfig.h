@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -19,6 +20,10 @@ namespace Yamen::Client {
 
         // Asset Settings
         std::string AssetRoot = "Assets";
+        size_t AssetMemoryBudget = 128 * 1024 * 1024;  // Fixed pool for loaded asset data
+
+        // Threading Settings
+        uint32_t WorkerThreads = 0;  // Scene worker pool size (0 = one per core, less the main thread)
 
         // Scene Settings
         std::string StartScene = "ECS Scene";
@@ -2,10 +2,12 @@
 #include "Client/GameLayer.h"
 #include "Client/ImGuiLayer.h"
 #include <Core/Logging/Logger.h>
+#include <Core/Threading/MainThreadScheduler.h>
 #include "Graphics/RHI/RenderTarget.h"
 #include "Graphics/RHI/DepthStencilBuffer.h"
 #include "Platform/Timer.h"
 #include "Platform/Events/ApplicationEvents.h"
+#include <thread>
 
 namespace Yamen::Client {
 
@@ -23,6 +25,15 @@ namespace Yamen::Client {
         YAMEN_CLIENT_INFO("=== Yamen Engine Starting ===");
         YAMEN_CLIENT_INFO("Config: {} ({}x{})", config.WindowTitle, config.WindowWidth, config.WindowHeight);
 
+        m_AssetAllocator = std::make_unique<Core::TLSFAllocator>(config.AssetMemoryBudget, Core::MemoryTag::Assets);
+
+        // The main thread takes part in parallel loops, so leave it a core
+        const unsigned cores = std::thread::hardware_concurrency();
+        const size_t workerThreads = config.WorkerThreads > 0
+            ? config.WorkerThreads
+            : (cores > 1 ? cores - 1 : 1);
+        m_ThreadPool = std::make_unique<Core::ThreadPool>(workerThreads);
+
         // Create window
         Platform::WindowProps props;
         props.title = config.WindowTitle;
@@ -82,6 +93,9 @@ namespace Yamen::Client {
             // Update timer
             float deltaTime = frameTimer.Update();
 
+            // Recycle the frame arena from two frames ago
+            m_FrameAllocator.BeginFrame();
+
             // Poll input and dispatch events
             m_InputDispatcher.Update();
 
@@ -91,6 +105,9 @@ namespace Yamen::Client {
             // Update layers
             m_LayerStack->OnUpdate(deltaTime);
 
+            // Resume coroutines waiting for the main thread (GPU uploads after async loads)
+            Core::MainThreadScheduler::ProcessFrame();
+
             // === RENDERING ===
 
             // Get back buffer and depth buffer
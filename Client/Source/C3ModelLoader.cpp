@@ -1,5 +1,6 @@
 #include "Client/C3ModelLoader.h"
 #include "AssetsC3/C3PhyLoader.h"
+#include "Client/Application.h"
 #include "Core/Logging/Logger.h"
 #include "ECS/Components/SkeletalAnimationComponent.h"
 #include "Graphics/RHI/Buffer.h"
@@ -34,9 +35,15 @@ entt::entity C3ModelLoader::LoadModel(entt::registry &registry,
   // Create entity
   auto entity = registry.create();
 
-  // Load PHY file
-  auto *phy = new Assets::C3Phy();
-  if (!Assets::C3PhyLoader::Load(filepath, *phy)) {
+  // Load PHY file; its data lives in the application's asset pool
+  auto *phy = new Assets::C3Phy(&Application::Get().GetAssetAllocator());
+  bool loaded = false;
+  try {
+    loaded = Assets::C3PhyLoader::Load(filepath, *phy);
+  } catch (const std::bad_alloc &) {
+    YAMEN_CORE_ERROR("Asset memory budget exhausted loading {}", filepath);
+  }
+  if (!loaded) {
     YAMEN_CORE_ERROR("Failed to load C3 model: {}", filepath);
     delete phy;
     registry.destroy(entity);
@@ -128,7 +135,8 @@ entt::entity C3ModelLoader::LoadModel(entt::registry &registry,
 
     // Copy Inverse Bind Matrices
     if (!phy->invBindMatrices.empty()) {
-      animComp.inverseBindMatrices = phy->invBindMatrices;
+      animComp.inverseBindMatrices.assign(phy->invBindMatrices.begin(),
+                                          phy->invBindMatrices.end());
     }
   }
 
@@ -1,4 +1,5 @@
 #include "Client/ECSScene.h"
+#include "Client/Application.h"
 #include "Client/CameraController.h"
 #include "ECS/Components.h"
 #include "ECS/Systems/CameraSystem.h"
@@ -6,6 +7,7 @@
 #include "ECS/Systems/PhysicsSystem.h"
 #include "ECS/Systems/RenderSystem.h"
 #include "ECS/Systems/ScriptSystem.h"
+#include "ECS/Systems/TransformSystem.h"
 #include "Graphics/Mesh/MeshBuilder.h"
 #include "Graphics/Texture/TextureLoader.h"
 #include <Core/Logging/Logger.h>
@@ -24,6 +26,8 @@ ECSScene::~ECSScene() {}
 
 bool ECSScene::Initialize() {
   m_Scene = std::make_unique<ECS::Scene>("Main Scene");
+  m_Scene->SetFrameAllocator(&Client::Application::Get().GetFrameAllocator());
+  m_Scene->SetThreadPool(&Client::Application::Get().GetThreadPool());
 
   m_Renderer3D = std::make_unique<Graphics::Renderer3D>(m_Device);
   if (!m_Renderer3D->Initialize()) {
@@ -42,6 +46,7 @@ bool ECSScene::Initialize() {
   m_Scene->AddSystem<ECS::ScriptSystem>();
   m_Scene->AddSystem<ECS::PhysicsSystem>();
   m_Scene->AddSystem<ECS::GizmoSystem>(); // Dynamic gizmo system
+  m_Scene->AddSystem<ECS::TransformSystem>();
   m_Scene->AddSystem<ECS::RenderSystem>(m_Device, m_Renderer3D.get(),
                                         m_Renderer2D.get());
   m_Scene->OnInit();
@@ -1,10 +1,12 @@
 #include "Client/PhysicsPlaygroundScene.h"
+#include "Client/Application.h"
 #include "Client/CameraController.h"
 #include "ECS/Components.h"
 #include "ECS/Systems/CameraSystem.h"
 #include "ECS/Systems/PhysicsSystem.h"
 #include "ECS/Systems/RenderSystem.h"
 #include "ECS/Systems/ScriptSystem.h"
+#include "ECS/Systems/TransformSystem.h"
 #include "Graphics/Mesh/MeshBuilder.h"
 #include <Core/Logging/Logger.h>
 #include <Core/Math/Math.h>
@@ -24,6 +26,8 @@ PhysicsPlaygroundScene::~PhysicsPlaygroundScene() {}
 
 bool PhysicsPlaygroundScene::Initialize() {
   m_Scene = std::make_unique<ECS::Scene>("Physics Playground");
+  m_Scene->SetFrameAllocator(&Client::Application::Get().GetFrameAllocator());
+  m_Scene->SetThreadPool(&Client::Application::Get().GetThreadPool());
 
   m_Renderer3D = std::make_unique<Graphics::Renderer3D>(m_Device);
   if (!m_Renderer3D->Initialize()) {
@@ -41,6 +45,7 @@ bool PhysicsPlaygroundScene::Initialize() {
   m_Scene->AddSystem<ECS::CameraSystem>();
   m_Scene->AddSystem<ECS::ScriptSystem>();
   m_Scene->AddSystem<ECS::PhysicsSystem>();
+  m_Scene->AddSystem<ECS::TransformSystem>();
   m_Scene->AddSystem<ECS::RenderSystem>(m_Device, m_Renderer3D.get(),
                                         m_Renderer2D.get());
   m_Scene->OnInit();
@@ -1,4 +1,5 @@
 ﻿#include "Client/Scenes/C3AnimationDemoScene.h"
+#include "Client/Application.h"
 #include "Core/Logging/Logger.h"
 #include "Platform/Input.h"
 #include <Core/Math/Math.h>
@@ -218,7 +219,8 @@ void C3AnimationDemoScene::Update(float deltaTime) {
 
   if (!m_AnimationPaused) {
     ECS::SkeletalAnimationSystem::Update(
-        m_Registry, deltaTime * (m_AnimationSpeed / 30.0f));
+        m_Registry, deltaTime * (m_AnimationSpeed / 30.0f),
+        &Client::Application::Get().GetThreadPool());
   }
 }
 
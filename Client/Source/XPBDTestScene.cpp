@@ -1,11 +1,14 @@
 #include "Client/XPBDTestScene.h"
+#include "Client/Application.h"
 #include "Client/CameraController.h"
 #include "ECS/Components.h"
 #include "ECS/Components/XPBDComponents.h"
 #include "ECS/Physics/PhysicsMaterial.h"
+#include "ECS/Physics/XPBDConstraintStore.h"
 #include "ECS/Systems/CameraSystem.h"
 #include "ECS/Systems/RenderSystem.h"
 #include "ECS/Systems/ScriptSystem.h"
+#include "ECS/Systems/TransformSystem.h"
 #include "ECS/Systems/XPBDSolver.h"
 #include "Graphics/Mesh/MeshBuilder.h"
 #include <Core/Logging/Logger.h>
@@ -24,6 +27,7 @@ XPBDTestScene::~XPBDTestScene() {}
 
 bool XPBDTestScene::Initialize() {
   m_Scene = std::make_unique<ECS::Scene>("XPBD Test Scene");
+  m_Scene->SetThreadPool(&Client::Application::Get().GetThreadPool());
 
   m_Renderer3D = std::make_unique<Graphics::Renderer3D>(m_Device);
   if (!m_Renderer3D->Initialize()) {
@@ -41,6 +45,7 @@ bool XPBDTestScene::Initialize() {
   m_Scene->AddSystem<ECS::CameraSystem>();
   m_Scene->AddSystem<ECS::ScriptSystem>();
   m_Scene->AddSystem<ECS::XPBDSolver>(); // Use XPBD solver instead of legacy
+  m_Scene->AddSystem<ECS::TransformSystem>();
   m_Scene->AddSystem<ECS::RenderSystem>(m_Device, m_Renderer3D.get(),
                                         m_Renderer2D.get());
   m_Scene->OnInit();
@@ -410,9 +415,8 @@ void XPBDTestScene::CreateDistanceConstraint(entt::entity a, entt::entity b,
   float restLength = Math::Length(pA->Position - pB->Position);
 
   auto constraintEntity = m_Scene->CreateEntity("DistanceConstraint");
-  auto &constraint =
-      constraintEntity.AddComponent<ECS::XPBDConstraintComponent>();
-  constraint.Constraint = ECS::DistanceConstraint(a, b, restLength, compliance);
+  ECS::XPBDConstraintStore::Get(registry).Emplace(
+      constraintEntity, ECS::DistanceConstraint(a, b, restLength, compliance));
 }
 
 void XPBDTestScene::CreateRope(const vec3 &start, const vec3 &end, int segments,
@@ -60,8 +60,47 @@ struct TransformComponent {
   }
 };
 
+/**
+ * @brief Cached world matrix of a TransformComponent
+ *
+ * TransformSystem rebuilds Matrix once per frame, in one batch, for every
+ * entity that is Dirty or whose Translation/Rotation/Scale no longer match the
+ * values the matrix was built from. Renderers read Matrix instead of calling
+ * GetTransform() per pass. For entities with a parent, TransformHierarchySystem
+ * then replaces Matrix with the local matrix times the parent's world matrix.
+ */
+struct WorldMatrixComponent {
+  mat4 Matrix = mat4(1.0f);
+  bool Dirty = true;
+
+  // Set when Matrix was rebuilt from the local transform this frame;
+  // TransformHierarchySystem consumes it and replaces Matrix for children
+  bool LocalChanged = false;
+
+  // Transform the matrix was built from
+  vec3 Translation = vec3(0.0f);
+  quat Rotation = quat(0.0f, 0.0f, 0.0f, 1.0f);
+  vec3 Scale = vec3(1.0f);
+
+  WorldMatrixComponent() = default;
+  WorldMatrixComponent(const WorldMatrixComponent &) = default;
+
+  void MarkDirty() { Dirty = true; }
+
+  bool Matches(const TransformComponent &transform) const {
+    return Translation == transform.Translation &&
+           Rotation.x == transform.Rotation.x &&
+           Rotation.y == transform.Rotation.y &&
+           Rotation.z == transform.Rotation.z &&
+           Rotation.w == transform.Rotation.w && Scale == transform.Scale;
+  }
+};
+
 /**
  * @brief Hierarchy component for parent-child relationships
+ *
+ * Parent is authoritative for TransformHierarchySystem; Children is kept for
+ * gameplay code that walks down the tree.
  */
 struct HierarchyComponent {
   entt::entity Parent = entt::null;
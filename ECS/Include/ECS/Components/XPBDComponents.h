@@ -3,8 +3,9 @@
 #include "ECS/Physics/PhysicsMaterial.h"
 #include <Core/Math/Math.h>
 #include <entt/entt.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
-#include <variant>
 #include <vector>
 
 namespace Yamen::ECS {
@@ -41,6 +42,20 @@ struct XPBDParticleComponent {
   void AddForce(const vec3 &force) { ExternalForce += force; }
 };
 
+/**
+ * @brief Persistent constraint types, in the order the solver runs them
+ */
+enum class XPBDConstraintType : uint8_t {
+  Distance,
+  Bending,
+  Volume,
+  ShapeMatching,
+  BallSocket,
+  Hinge,
+  Slider
+};
+inline constexpr size_t XPBDConstraintTypeCount = 7;
+
 /**
  * @brief Base constraint data for XPBD
  *
@@ -51,8 +66,6 @@ struct XPBDConstraintBase {
   float Compliance = 0.0f; // Inverse stiffness (0 = rigid)
   float Lambda = 0.0f;     // Lagrange multiplier (for warm starting)
   bool Active = true;
-
-  virtual ~XPBDConstraintBase() = default;
 };
 
 /**
@@ -62,6 +75,8 @@ struct XPBDConstraintBase {
  * C = |p1 - p2| - rest_length
  */
 struct DistanceConstraint : public XPBDConstraintBase {
+  static constexpr XPBDConstraintType Type = XPBDConstraintType::Distance;
+
   entt::entity ParticleA = entt::null;
   entt::entity ParticleB = entt::null;
   float RestLength = 1.0f;
@@ -82,6 +97,8 @@ struct DistanceConstraint : public XPBDConstraintBase {
  *
  * Prevents penetration between colliding objects.
  * C = dot(p1 - p2, normal) - penetration
+ *
+ * Generated by the solver every substep; not a persistent constraint type.
  */
 struct ContactConstraint : public XPBDConstraintBase {
   entt::entity ParticleA = entt::null;
@@ -109,6 +126,8 @@ struct ContactConstraint : public XPBDConstraintBase {
  * C = acos(dot(n1, n2)) - rest_angle
  */
 struct BendingConstraint : public XPBDConstraintBase {
+  static constexpr XPBDConstraintType Type = XPBDConstraintType::Bending;
+
   entt::entity Particle0 = entt::null; // Shared edge vertex 1
   entt::entity Particle1 = entt::null; // Shared edge vertex 2
   entt::entity Particle2 = entt::null; // Triangle 1 opposite vertex
@@ -132,6 +151,8 @@ struct BendingConstraint : public XPBDConstraintBase {
  * C = V_current - V_rest
  */
 struct VolumeConstraint : public XPBDConstraintBase {
+  static constexpr XPBDConstraintType Type = XPBDConstraintType::Volume;
+
   entt::entity Particle0 = entt::null;
   entt::entity Particle1 = entt::null;
   entt::entity Particle2 = entt::null;
@@ -155,6 +176,8 @@ struct VolumeConstraint : public XPBDConstraintBase {
  * Used for rigid body simulation and soft body stiffness.
  */
 struct ShapeMatchingConstraint : public XPBDConstraintBase {
+  static constexpr XPBDConstraintType Type = XPBDConstraintType::ShapeMatching;
+
   std::vector<entt::entity> Particles;
   std::vector<vec3> RestPositions; // Relative to center of mass
   vec3 RestCenterOfMass = vec3(0.0f);
@@ -173,6 +196,8 @@ struct ShapeMatchingConstraint : public XPBDConstraintBase {
  * C = p1 - p2
  */
 struct BallSocketConstraint : public XPBDConstraintBase {
+  static constexpr XPBDConstraintType Type = XPBDConstraintType::BallSocket;
+
   entt::entity ParticleA = entt::null;
   entt::entity ParticleB = entt::null;
 
@@ -193,6 +218,8 @@ struct BallSocketConstraint : public XPBDConstraintBase {
  * Constrains rotation to a single axis.
  */
 struct HingeConstraint : public XPBDConstraintBase {
+  static constexpr XPBDConstraintType Type = XPBDConstraintType::Hinge;
+
   entt::entity ParticleA = entt::null;
   entt::entity ParticleB = entt::null;
 
@@ -219,6 +246,8 @@ struct HingeConstraint : public XPBDConstraintBase {
  * Constrains motion to a single axis (prismatic joint).
  */
 struct SliderConstraint : public XPBDConstraintBase {
+  static constexpr XPBDConstraintType Type = XPBDConstraintType::Slider;
+
   entt::entity ParticleA = entt::null;
   entt::entity ParticleB = entt::null;
 
@@ -235,40 +264,20 @@ struct SliderConstraint : public XPBDConstraintBase {
 /**
  * @brief XPBD Constraint Component
  *
- * Variant holding any constraint type. Attached to entities
- * to participate in constraint solving.
+ * Handle to a persistent constraint in the registry's XPBDConstraintStore,
+ * which packs constraints by type. Create it with
+ * XPBDConstraintStore::Emplace(); removing the component or destroying its
+ * entity removes the constraint.
  */
 struct XPBDConstraintComponent {
-  using ConstraintVariant =
-      std::variant<DistanceConstraint, ContactConstraint, BendingConstraint,
-                   VolumeConstraint, ShapeMatchingConstraint,
-                   BallSocketConstraint, HingeConstraint, SliderConstraint>;
-
-  ConstraintVariant Constraint;
+  XPBDConstraintType Type = XPBDConstraintType::Distance;
+  uint32_t Slot = UINT32_MAX; // Store slot, UINT32_MAX = no constraint
 
   // Priority for solving order (higher = solved first)
   int Priority = 0;
 
   // Material override (if null, uses default)
   std::shared_ptr<PhysicsMaterial> Material;
-
-  // Constructors for convenience
-  XPBDConstraintComponent() = default;
-
-  template <typename T>
-  XPBDConstraintComponent(const T &constraint) : Constraint(constraint) {}
-
-  // Helper to get constraint base
-  XPBDConstraintBase *GetBase() {
-    return std::visit([](auto &c) -> XPBDConstraintBase * { return &c; },
-                      Constraint);
-  }
-
-  const XPBDConstraintBase *GetBase() const {
-    return std::visit(
-        [](const auto &c) -> const XPBDConstraintBase * { return &c; },
-        Constraint);
-  }
 };
 
 } // namespace Yamen::ECS
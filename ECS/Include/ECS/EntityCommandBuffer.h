@@ -0,0 +1,218 @@
+#pragma once
+
+#include <Core/Memory/ThreadSlots.h>
+#include <entt/entt.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Yamen::ECS {
+
+    class EntityCommandBuffer;
+
+    /**
+     * @brief Entity recorded by EntityCommandBuffer::Create(), created on playback
+     *
+     * Only valid with the buffer that returned it, until that buffer is played back.
+     */
+    struct DeferredEntity {
+        const EntityCommandBuffer* owner = nullptr;
+        uint32_t index = 0;
+
+        bool IsValid() const noexcept { return owner != nullptr; }
+    };
+
+    /**
+     * @brief Records structural registry changes for later playback
+     *
+     * Creates, destroys and component emplace/remove are recorded instead of
+     * applied, so systems running on worker threads can request them safely; the
+     * owning EntityCommandQueue applies them on the main thread at a sync point.
+     * Commands and component payloads live in the memory resource given on
+     * recording (the scene's frame allocator while it updates), or in a heap
+     * arena released after playback when there is none.
+     *
+     * Playback order is by sort key, then by recording order. Give each unit of
+     * parallel work its own key (e.g. the entity being processed) so the result
+     * does not depend on which worker ran it:
+     * @code
+     * auto& commands = scene->GetCommandBuffer();
+     * commands.SetSortKey(entt::to_integral(entity));
+     * DeferredEntity spark = commands.Create();
+     * commands.Emplace<TransformComponent>(spark, hitPoint);
+     * @endcode
+     *
+     * A buffer is used by one thread at a time.
+     */
+    class EntityCommandBuffer {
+    public:
+        EntityCommandBuffer() = default;
+        ~EntityCommandBuffer();
+
+        // Non-copyable
+        EntityCommandBuffer(const EntityCommandBuffer&) = delete;
+        EntityCommandBuffer& operator=(const EntityCommandBuffer&) = delete;
+
+        /**
+         * @brief Set the sort key of commands recorded from now on
+         */
+        void SetSortKey(uint64_t sortKey) noexcept { m_SortKey = sortKey; }
+
+        /**
+         * @brief Record the creation of an entity with no components
+         */
+        DeferredEntity Create();
+
+        /**
+         * @brief Record the destruction of @p entity (skipped if it is gone by then)
+         */
+        void Destroy(entt::entity entity);
+        void Destroy(DeferredEntity entity);
+
+        /**
+         * @brief Record emplacing (or replacing) a T built from @p args
+         */
+        template<typename T, typename... Args>
+        void Emplace(entt::entity entity, Args&&... args) {
+            EmplaceCommand<T>(entity, NoDeferred, std::forward<Args>(args)...);
+        }
+
+        template<typename T, typename... Args>
+        void Emplace(DeferredEntity entity, Args&&... args) {
+            EmplaceCommand<T>(entt::null, Resolve(entity), std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Record removing T, if present at playback
+         */
+        template<typename T>
+        void Remove(entt::entity entity) {
+            Record(CommandType::Remove, entity, NoDeferred, nullptr, &RemoveComponent<T>, nullptr);
+        }
+
+        template<typename T>
+        void Remove(DeferredEntity entity) {
+            Record(CommandType::Remove, entt::null, Resolve(entity), nullptr, &RemoveComponent<T>, nullptr);
+        }
+
+        bool IsEmpty() const noexcept { return m_Head == nullptr; }
+        size_t GetCommandCount() const noexcept { return m_Count; }
+
+    private:
+        friend class EntityCommandQueue;
+
+        static constexpr uint32_t NoDeferred = UINT32_MAX;
+
+        enum class CommandType : uint8_t {
+            Create,
+            Destroy,
+            Emplace,
+            Remove
+        };
+
+        using ApplyFn = void(*)(entt::registry& registry, entt::entity entity, void* payload);
+        using DestroyFn = void(*)(void* payload);
+
+        struct Command {
+            Command* next;
+            uint64_t sortKey;
+            uint32_t sequence;
+            uint32_t deferred;      // Index of a Create in this buffer, or NoDeferred
+            entt::entity entity;    // Target when deferred is NoDeferred
+            CommandType type;
+            void* payload;
+            ApplyFn apply;
+            DestroyFn destroy;      // Runs the payload's destructor, if it has one
+        };
+
+        template<typename T, typename... Args>
+        void EmplaceCommand(entt::entity entity, uint32_t deferred, Args&&... args) {
+            void* payload = Allocate(sizeof(T), alignof(T));
+            new (payload) T(std::forward<Args>(args)...);
+
+            DestroyFn destroy = nullptr;
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                destroy = [](void* p) { static_cast<T*>(p)->~T(); };
+            }
+            Record(CommandType::Emplace, entity, deferred, payload, &EmplaceComponent<T>, destroy);
+        }
+
+        template<typename T>
+        static void EmplaceComponent(entt::registry& registry, entt::entity entity, void* payload) {
+            registry.emplace_or_replace<T>(entity, std::move(*static_cast<T*>(payload)));
+        }
+
+        template<typename T>
+        static void RemoveComponent(entt::registry& registry, entt::entity entity, void*) {
+            registry.remove<T>(entity);
+        }
+
+        uint32_t Resolve(DeferredEntity entity) const;
+        void Record(CommandType type, entt::entity entity, uint32_t deferred,
+            void* payload, ApplyFn apply, DestroyFn destroy);
+        void* Allocate(size_t size, size_t alignment);
+
+        // Choose where the next commands are stored; only takes effect while empty
+        void BindResource(std::pmr::memory_resource* resource) noexcept;
+
+        // Run outstanding payload destructors and forget every command
+        void Reset() noexcept;
+
+        Command* m_Head = nullptr;
+        Command* m_Tail = nullptr;
+        size_t m_Count = 0;
+        uint32_t m_CreateCount = 0;
+        uint64_t m_SortKey = 0;
+
+        std::pmr::memory_resource* m_Resource = nullptr;
+        std::unique_ptr<std::pmr::monotonic_buffer_resource> m_Fallback;
+    };
+
+    /**
+     * @brief One EntityCommandBuffer per thread, played back together
+     *
+     * Each thread records into its own buffer without locking. Playback runs on
+     * the main thread while no thread records: it merges every buffer, orders the
+     * commands by (sort key, buffer, recording order), creates all deferred
+     * entities first and then applies the rest in that order.
+     */
+    class EntityCommandQueue {
+    public:
+        EntityCommandQueue() = default;
+        ~EntityCommandQueue() = default;
+
+        // Non-copyable
+        EntityCommandQueue(const EntityCommandQueue&) = delete;
+        EntityCommandQueue& operator=(const EntityCommandQueue&) = delete;
+
+        /**
+         * @brief Get the calling thread's buffer
+         * @param resource Memory for commands recorded until the next playback (nullptr = heap arena)
+         */
+        EntityCommandBuffer& GetThreadBuffer(std::pmr::memory_resource* resource);
+
+        /**
+         * @brief Apply and clear every recorded command
+         * @return Number of commands applied
+         */
+        size_t Playback(entt::registry& registry);
+
+        bool IsEmpty() const noexcept;
+
+    private:
+        std::array<std::unique_ptr<EntityCommandBuffer>, Core::ThreadSlots::MaxSlots> m_Buffers;
+
+        // Threads without a slot get a fresh buffer per request
+        mutable std::mutex m_OverflowMutex;
+        std::vector<std::unique_ptr<EntityCommandBuffer>> m_Overflow;
+    };
+
+} // namespace Yamen::ECS
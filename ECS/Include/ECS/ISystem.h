@@ -1,5 +1,6 @@
 #pragma once
 
+#include "ECS/SystemAccess.h"
 #include <Core/Logging/Logger.h>
 
 namespace Yamen::ECS {
@@ -10,7 +11,10 @@ namespace Yamen::ECS {
      * @brief Base interface for all ECS systems
      * 
      * Systems process entities with specific component combinations.
-     * Priority determines execution order (lower = earlier).
+     * Priority determines execution order (lower = earlier). Systems that
+     * declare their component access through GetAccess() may run at the same
+     * time as other systems they do not conflict with; priority then only orders
+     * conflicting systems.
      */
     class ISystem {
     public:
@@ -24,6 +28,9 @@ namespace Yamen::ECS {
 
         // Priority for execution order (lower = earlier)
         virtual int GetPriority() const { return 100; }
+
+        // Components touched in OnUpdate; queried when the scene re-sorts its systems
+        virtual SystemAccess GetAccess() const { return SystemAccess::Exclusive(); }
         
         // System name for debugging
         virtual const char* GetName() const = 0;
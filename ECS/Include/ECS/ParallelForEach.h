@@ -0,0 +1,53 @@
+#pragma once
+
+#include <Core/Threading/ParallelFor.h>
+#include <entt/entt.hpp>
+
+namespace Yamen::ECS {
+
+    /**
+     * @brief Run fn(entity, components...) for every entity that has all @p Components
+     *
+     * Iteration is driven by the packed storage of the first component type, split
+     * into chunks of whole cache lines and spread over the thread pool. Put the
+     * rarest component first. Falls back to a plain serial loop when @p threadPool
+     * is null, or when the storage is small and no explicit grain size was given.
+     *
+     * The callback may freely modify the components it receives, but must not add or
+     * remove components or entities; record those in Scene::GetCommandBuffer() instead.
+     *
+     * @param grainSize Entities per chunk (0 = automatic)
+     */
+    template<typename First, typename... Rest, typename Fn>
+    void ParallelForEach(Core::ThreadPool* threadPool, entt::registry& registry, Fn&& fn, size_t grainSize = 0) {
+        auto view = registry.view<First, Rest...>();
+        auto& storage = registry.storage<First>();
+
+        const entt::entity* entities = storage.data();
+        const size_t count = storage.size();
+
+        auto processRange = [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const entt::entity entity = entities[i];
+                if constexpr (sizeof...(Rest) > 0) {
+                    if (!view.contains(entity)) {
+                        continue;
+                    }
+                }
+                fn(entity, view.template get<First>(entity), view.template get<Rest>(entity)...);
+            }
+        };
+
+        if (!threadPool || (grainSize == 0 && count < Core::ParallelForSettings::SerialThreshold)) {
+            processRange(0, count);
+            return;
+        }
+
+        if (grainSize == 0) {
+            grainSize = Core::ComputeGrainSize(count, threadPool->GetThreadCount() + 1, sizeof(First));
+        }
+
+        Core::ParallelForChunked(*threadPool, Core::IndexRange{ 0, count }, grainSize, processRange);
+    }
+
+} // namespace Yamen::ECS
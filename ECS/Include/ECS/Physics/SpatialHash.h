@@ -2,8 +2,8 @@
 
 #include <Core/Math/Math.h>
 #include <entt/entt.hpp>
-#include <functional>
-#include <unordered_map>
+#include <cstdint>
+#include <memory_resource>
 #include <vector>
 
 
@@ -15,53 +15,85 @@ namespace Yamen::ECS {
  * Reduces collision detection from O(N²) to O(N) by partitioning space into
  * cells. Only objects in the same or neighboring cells need to be tested for
  * collision.
+ *
+ * Insert() only records the entity and its bounds. The grid is built on the
+ * first query after a change, as a counting sort: every (cell, entity) entry
+ * is hashed into a power-of-two bucket table, the bucket counts are
+ * prefix-summed and the entries scattered into one flat array. Clear() just
+ * forgets the entities; all arrays keep their capacity across frames.
+ *
+ * Queries are const and may run concurrently once the grid is built; call
+ * Build() first if the first query could come from several threads at once.
  */
 class SpatialHash {
 public:
+  struct EntityPair {
+    entt::entity EntityA;
+    entt::entity EntityB;
+  };
+
   SpatialHash(float cellSize = 2.0f);
 
-  // Clear all entries
+  // Clear all entries (O(1), memory is kept)
   void Clear();
 
   // Insert an entity with its AABB
   void Insert(entt::entity entity, const Yamen::Core::vec3 &min,
               const Yamen::Core::vec3 &max);
 
-  // Query entities that could collide with the given AABB
+  // Sort the inserted entities into cells (done on demand by the queries)
+  void Build();
+
+  // Query entities that could collide with the given AABB, each once
   void Query(const Yamen::Core::vec3 &min, const Yamen::Core::vec3 &max,
-             std::vector<entt::entity> &results) const;
+             std::pmr::vector<entt::entity> &results) const;
+
+  // Append every pair of inserted entities whose AABBs overlap, each once, in
+  // insertion order of the first entity
+  void QueryPairs(std::pmr::vector<EntityPair> &pairs) const;
 
   // Get cell size
   float GetCellSize() const { return m_CellSize; }
 
+  // Change cell size; clears all entries
+  void SetCellSize(float cellSize);
+
   // Statistics
-  int GetCellCount() const { return static_cast<int>(m_Grid.size()); }
-  int GetTotalEntries() const { return m_TotalEntries; }
+  int GetCellCount() const;  // Occupied buckets
+  int GetTotalEntries() const; // Cell entries (an entity counts once per cell)
 
 private:
   struct CellKey {
     int x, y, z;
-
-    bool operator==(const CellKey &other) const {
-      return x == other.x && y == other.y && z == other.z;
-    }
   };
 
-  struct CellKeyHash {
-    std::size_t operator()(const CellKey &key) const {
-      // Simple hash combining
-      return std::hash<int>()(key.x) ^ (std::hash<int>()(key.y) << 1) ^
-             (std::hash<int>()(key.z) << 2);
-    }
+  struct Item {
+    entt::entity entity;
+    Yamen::Core::vec3 min;
+    Yamen::Core::vec3 max;
+    CellKey minCell;
+    CellKey maxCell;
   };
 
   CellKey GetCellKey(const Yamen::Core::vec3 &position) const;
-  void GetCellRange(const Yamen::Core::vec3 &min, const Yamen::Core::vec3 &max,
-                    CellKey &minKey, CellKey &maxKey) const;
+  uint32_t GetBucket(const CellKey &key) const;
+  void EnsureBuilt() const;
+  void BuildCells() const;
+
+  static bool Contains(const Item &item, const CellKey &key);
 
   float m_CellSize;
-  std::unordered_map<CellKey, std::vector<entt::entity>, CellKeyHash> m_Grid;
-  int m_TotalEntries = 0;
+  float m_InverseCellSize;
+
+  std::vector<Item> m_Items;
+  size_t m_EntryCount = 0;
+
+  // Built grid: entries of bucket b are m_Entries[m_BucketStart[b] ..
+  // m_BucketStart[b + 1]), as indices into m_Items
+  mutable std::vector<uint32_t> m_BucketStart;
+  mutable std::vector<uint32_t> m_Entries;
+  mutable uint32_t m_BucketMask = 0;
+  mutable bool m_Built = false;
 };
 
 } // namespace Yamen::ECS
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "ECS/Components/XPBDComponents.h"
+#include <entt/entt.hpp>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Yamen::ECS {
+
+/**
+ * @brief Packed constraints of one type
+ *
+ * After XPBDConstraintStore::PartitionByCompliance(), the constraints in
+ * [0, RigidCount) have zero compliance and the rest are compliant.
+ */
+template <typename T> struct XPBDConstraintArray {
+  using ConstraintType = T;
+  static constexpr XPBDConstraintType Type = T::Type;
+
+  std::vector<T> Constraints;
+  std::vector<uint32_t> Slots; // Store slot of each constraint
+  uint32_t RigidCount = 0;
+
+  uint32_t Size() const { return static_cast<uint32_t>(Constraints.size()); }
+};
+
+/**
+ * @brief Persistent XPBD constraints, packed by type
+ *
+ * Each constraint type lives in its own array, so the solver runs one tight
+ * loop per type instead of dispatching per constraint. XPBDConstraintComponent
+ * is a handle to a slot of the store; removing the component or destroying
+ * its entity removes the constraint. Each registry has one store, kept in its
+ * context:
+ * @code
+ * auto &constraints = XPBDConstraintStore::Get(registry);
+ * constraints.Emplace(registry.create(), DistanceConstraint(a, b, 1.0f));
+ * @endcode
+ *
+ * Removing a constraint moves the last one of its type into its place, and
+ * partitioning reorders each array, so references into the arrays only last
+ * until the next change. Handles stay valid until their constraint is
+ * removed; do not copy a handle component onto another entity.
+ */
+class XPBDConstraintStore {
+public:
+  static constexpr uint32_t NoSlot = UINT32_MAX;
+
+  // One array per XPBDConstraintType, in enum order
+  using Arrays = std::tuple<XPBDConstraintArray<DistanceConstraint>,
+                            XPBDConstraintArray<BendingConstraint>,
+                            XPBDConstraintArray<VolumeConstraint>,
+                            XPBDConstraintArray<ShapeMatchingConstraint>,
+                            XPBDConstraintArray<BallSocketConstraint>,
+                            XPBDConstraintArray<HingeConstraint>,
+                            XPBDConstraintArray<SliderConstraint>>;
+
+  explicit XPBDConstraintStore(entt::registry &registry);
+  XPBDConstraintStore(const XPBDConstraintStore &) = delete;
+  XPBDConstraintStore &operator=(const XPBDConstraintStore &) = delete;
+
+  // The registry's store, created on first use. Create it on the main thread
+  // before systems update, e.g. from a system's OnInit.
+  static XPBDConstraintStore &Get(entt::registry &registry);
+
+  // The registry's store, or nullptr if it has none yet
+  static XPBDConstraintStore *Find(entt::registry &registry);
+
+  // Add a constraint and attach its handle to entity, replacing the
+  // constraint the entity already holds
+  template <typename T>
+  XPBDConstraintComponent &Emplace(entt::entity entity, const T &constraint) {
+    // Attach the handle first, so a throw from the registry leaves the
+    // arrays untouched
+    auto &handle = m_Registry->all_of<XPBDConstraintComponent>(entity)
+                       ? m_Registry->get<XPBDConstraintComponent>(entity)
+                       : m_Registry->emplace<XPBDConstraintComponent>(entity);
+    if (IsValid(handle))
+      Remove(handle.Slot);
+    handle.Type = T::Type;
+    handle.Slot = NoSlot;
+
+    auto &array = GetArray<T>();
+    handle.Slot = AllocateSlot(T::Type, array.Size());
+    array.Constraints.push_back(constraint);
+    array.Slots.push_back(handle.Slot);
+    return handle;
+  }
+
+  // The constraint behind a handle, or nullptr if it is not a T
+  template <typename T> T *TryGet(const XPBDConstraintComponent &handle) {
+    if (handle.Type != T::Type || !IsValid(handle))
+      return nullptr;
+    return &GetArray<T>().Constraints[m_Slots[handle.Slot].Index];
+  }
+
+  // Compliance, lambda and active flag of the constraint behind a handle
+  XPBDConstraintBase *GetBase(const XPBDConstraintComponent &handle);
+
+  bool IsValid(const XPBDConstraintComponent &handle) const {
+    return handle.Slot < m_Slots.size() && m_Slots[handle.Slot].Used &&
+           m_Slots[handle.Slot].Type == handle.Type;
+  }
+
+  template <typename T> XPBDConstraintArray<T> &GetArray() {
+    return std::get<XPBDConstraintArray<T>>(m_Arrays);
+  }
+
+  // fn(array) for every type's array, in XPBDConstraintType order
+  template <typename Fn> void ForEachArray(Fn &&fn) {
+    std::apply([&](auto &...arrays) { (fn(arrays), ...); }, m_Arrays);
+  }
+
+  // fn(array) for the array of one type
+  template <typename Fn> void VisitArray(XPBDConstraintType type, Fn &&fn) {
+    switch (type) {
+    case XPBDConstraintType::Distance:
+      fn(std::get<0>(m_Arrays));
+      break;
+    case XPBDConstraintType::Bending:
+      fn(std::get<1>(m_Arrays));
+      break;
+    case XPBDConstraintType::Volume:
+      fn(std::get<2>(m_Arrays));
+      break;
+    case XPBDConstraintType::ShapeMatching:
+      fn(std::get<3>(m_Arrays));
+      break;
+    case XPBDConstraintType::BallSocket:
+      fn(std::get<4>(m_Arrays));
+      break;
+    case XPBDConstraintType::Hinge:
+      fn(std::get<5>(m_Arrays));
+      break;
+    case XPBDConstraintType::Slider:
+      fn(std::get<6>(m_Arrays));
+      break;
+    }
+  }
+
+  // Total number of constraints
+  size_t Size() const;
+
+  // Move each type's rigid constraints in front of its compliant ones and
+  // update RigidCount. Keeps the order of arrays that are already partitioned.
+  void PartitionByCompliance();
+
+private:
+  struct Slot {
+    uint32_t Index = 0; // Into the array of Type
+    XPBDConstraintType Type = XPBDConstraintType::Distance;
+    bool Used = false;
+  };
+
+  uint32_t AllocateSlot(XPBDConstraintType type, uint32_t index);
+  void Remove(uint32_t slot);
+  void OnDestroy(entt::registry &registry, entt::entity entity);
+
+  template <typename T>
+  void Swap(XPBDConstraintArray<T> &array, uint32_t a, uint32_t b) {
+    std::swap(array.Constraints[a], array.Constraints[b]);
+    std::swap(array.Slots[a], array.Slots[b]);
+    m_Slots[array.Slots[a]].Index = a;
+    m_Slots[array.Slots[b]].Index = b;
+  }
+
+  entt::registry *m_Registry;
+  Arrays m_Arrays;
+  std::vector<Slot> m_Slots;
+  std::vector<uint32_t> m_FreeSlots;
+};
+
+} // namespace Yamen::ECS
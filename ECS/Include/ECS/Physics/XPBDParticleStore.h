@@ -0,0 +1,52 @@
+#pragma once
+
+#include "ECS/Components/XPBDComponents.h"
+#include <Core/Math/Math.h>
+#include <entt/entt.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace Yamen::ECS {
+
+/**
+ * @brief Packed copy of the XPBD particles for one solver update
+ *
+ * Gather() copies the simulation state of every particle into one array per
+ * field, in the order of the particle storage, so the dense index of a
+ * particle is its index in that storage. The solver then works on the arrays
+ * only, and Scatter() writes the results back to the components.
+ *
+ * Indices stay valid from Gather() to Scatter() as long as no particle is
+ * added or removed in between.
+ */
+class XPBDParticleStore {
+public:
+  static constexpr uint32_t NoIndex = UINT32_MAX;
+
+  // Copy every particle into the arrays
+  void Gather(const entt::storage<XPBDParticleComponent> &particles);
+
+  // Write positions, velocities and consumed forces back to the components
+  void Scatter(entt::storage<XPBDParticleComponent> &particles) const;
+
+  // Dense index of the entity's particle, or NoIndex if it has none
+  uint32_t IndexOf(entt::entity entity) const {
+    return m_Particles && m_Particles->contains(entity)
+               ? static_cast<uint32_t>(m_Particles->index(entity))
+               : NoIndex;
+  }
+
+  size_t Size() const { return Positions.size(); }
+
+  std::vector<Yamen::Core::vec3> Positions;
+  std::vector<Yamen::Core::vec3> PreviousPositions;
+  std::vector<Yamen::Core::vec3> Velocities;
+  std::vector<Yamen::Core::vec3> ExternalForces;
+  std::vector<float> InverseMasses;
+  std::vector<uint8_t> Sleeping;
+
+private:
+  const entt::storage<XPBDParticleComponent> *m_Particles = nullptr;
+};
+
+} // namespace Yamen::ECS
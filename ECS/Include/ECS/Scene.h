@@ -1,22 +1,30 @@
 #pragma once
 
+#include "ECS/SystemAccess.h"
 #include <entt/entt.hpp>
 #include <Core/Logging/Logger.h>
 #include <string>
 #include <memory>
 #include <vector>
 
+namespace Yamen::Core {
+    class ThreadPool;
+    class FrameAllocator;
+}
+
 namespace Yamen::ECS {
 
     class Entity;
     class ISystem;
+    class EntityCommandBuffer;
+    class EntityCommandQueue;
 
     /**
      * @brief Scene manages entities, components, and systems
      * 
      * Professional scene management with:
      * - Multi-scene support
-     * - System priority execution
+     * - System priority execution, with non-conflicting systems run in parallel
      * - Component view caching
      * - Serialization support
      */
@@ -28,6 +36,26 @@ namespace Yamen::ECS {
         // Entity management
         Entity CreateEntity(const std::string& name = "");
         void DestroyEntity(Entity entity);
+
+        /**
+         * @brief Get the calling thread's command buffer
+         *
+         * Structural changes recorded here are applied at the next sync point:
+         * the start of OnUpdate and the end of each system phase (an exclusive
+         * system, or a run of systems that may execute in parallel). Record from
+         * worker threads instead of touching the registry directly.
+         *
+         * Commands recorded during OnUpdate live in the frame allocator; commands
+         * recorded outside it go to a heap arena, since a paused or idle scene may
+         * not play them back before the frame memory is recycled.
+         */
+        EntityCommandBuffer& GetCommandBuffer();
+
+        /**
+         * @brief Apply every recorded command now (main thread, no system running)
+         * @return Number of commands applied
+         */
+        size_t PlaybackCommands();
         
         // System management
         template<typename T, typename... Args>
@@ -52,12 +80,22 @@ namespace Yamen::ECS {
         const std::string& GetName() const { return m_Name; }
         void SetName(const std::string& name) { m_Name = name; }
 
+        // Worker pool for systems that split their work and for running
+        // non-conflicting systems at the same time (nullptr = run serially)
+        void SetThreadPool(Core::ThreadPool* threadPool) { m_ThreadPool = threadPool; }
+        Core::ThreadPool* GetThreadPool() const { return m_ThreadPool; }
+
+        // Per-frame scratch memory, installed as the scratch resource during OnUpdate/OnRender (nullptr = use the heap)
+        void SetFrameAllocator(Core::FrameAllocator* frameAllocator) { m_FrameAllocator = frameAllocator; }
+        Core::FrameAllocator* GetFrameAllocator() const { return m_FrameAllocator; }
+
         // Registry access
         entt::registry& Registry() { return m_Registry; }
         const entt::registry& Registry() const { return m_Registry; }
 
     private:
         void SortSystems();
+        void UpdateSystemsParallel(size_t begin, size_t end, float deltaTime);
 
         std::string m_Name;
         bool m_Active = true;
@@ -65,6 +103,17 @@ namespace Yamen::ECS {
         std::vector<std::unique_ptr<ISystem>> m_Systems;
         bool m_SystemsDirty = false;
 
+        // Per sorted system: declared access and the earlier systems it conflicts with
+        std::vector<SystemAccess> m_SystemAccess;
+        std::vector<std::vector<uint32_t>> m_SystemDependencies;
+        std::vector<size_t> m_SystemPhaseEnds;
+
+        std::unique_ptr<EntityCommandQueue> m_Commands;
+
+        Core::ThreadPool* m_ThreadPool = nullptr;
+        Core::FrameAllocator* m_FrameAllocator = nullptr;
+        bool m_Updating = false; // Inside OnUpdate: commands may use frame memory
+
         friend class Entity;
     };
 
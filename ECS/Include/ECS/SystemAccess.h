@@ -0,0 +1,107 @@
+#pragma once
+
+#include <entt/entt.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace Yamen::ECS {
+
+    /**
+     * @brief Components a system reads and writes in OnUpdate
+     *
+     * Scene runs systems whose access does not conflict at the same time on its
+     * thread pool. Two systems conflict when one writes a component the other
+     * reads or writes, or when either of them is exclusive. Emplacing or removing
+     * a component counts as writing it; creating or destroying entities, or
+     * touching anything outside the registry that another system also uses,
+     * requires Exclusive().
+     *
+     * @code
+     * SystemAccess GetAccess() const override {
+     *     return SystemAccess().Read<TransformComponent>().Write<CameraComponent>();
+     * }
+     * @endcode
+     */
+    class SystemAccess {
+    public:
+        /**
+         * @brief Access that conflicts with every other system
+         *
+         * Exclusive systems run alone, on the thread that updates the scene.
+         */
+        static SystemAccess Exclusive() {
+            SystemAccess access;
+            access.m_Exclusive = true;
+            return access;
+        }
+
+        template<typename... Components>
+        SystemAccess& Read() {
+            (Add<Components>(false), ...);
+            return *this;
+        }
+
+        template<typename... Components>
+        SystemAccess& Write() {
+            (Add<Components>(true), ...);
+            return *this;
+        }
+
+        bool IsExclusive() const noexcept { return m_Exclusive; }
+
+        /**
+         * @brief Check if this system must not run at the same time as @p other
+         */
+        bool ConflictsWith(const SystemAccess& other) const noexcept {
+            if (m_Exclusive || other.m_Exclusive) {
+                return true;
+            }
+
+            for (const Entry& mine : m_Entries) {
+                for (const Entry& theirs : other.m_Entries) {
+                    if (mine.type == theirs.type && (mine.write || theirs.write)) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Create the storage of every listed component up front
+         *
+         * The registry creates storages lazily on first use, which would insert
+         * into shared state from concurrently running systems.
+         */
+        void AssureStorage(entt::registry& registry) const {
+            for (const Entry& entry : m_Entries) {
+                entry.assure(registry);
+            }
+        }
+
+    private:
+        struct Entry {
+            entt::id_type type;
+            bool write;
+            void (*assure)(entt::registry&);
+        };
+
+        template<typename Component>
+        void Add(bool write) {
+            const entt::id_type type = entt::type_hash<Component>::value();
+            auto it = std::find_if(m_Entries.begin(), m_Entries.end(),
+                [type](const Entry& entry) { return entry.type == type; });
+
+            if (it != m_Entries.end()) {
+                it->write = it->write || write;
+                return;
+            }
+
+            m_Entries.push_back({ type, write, [](entt::registry& registry) { registry.storage<Component>(); } });
+        }
+
+        std::vector<Entry> m_Entries;
+        bool m_Exclusive = false;
+    };
+
+} // namespace Yamen::ECS
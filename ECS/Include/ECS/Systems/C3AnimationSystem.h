@@ -34,6 +34,9 @@ namespace Yamen::ECS {
 
         int GetPriority() const override { return 200; } // Update before rendering
         const char* GetName() const override { return "C3AnimationSystem"; }
+
+        // Touches no components yet; declare them here once OnUpdate does
+        SystemAccess GetAccess() const override { return SystemAccess(); }
     };
 
 } // namespace Yamen::ECS
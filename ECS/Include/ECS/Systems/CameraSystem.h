@@ -1,5 +1,7 @@
 #pragma once
 
+#include "ECS/Components/CoreComponents.h"
+#include "ECS/Components/RenderingComponents.h"
 #include "ECS/ISystem.h"
 #include "ECS/Scene.h"
 
@@ -23,6 +25,9 @@ namespace Yamen::ECS {
         void OnUpdate(Scene* scene, float deltaTime) override;
         int GetPriority() const override { return 50; } // Update before rendering
         const char* GetName() const override { return "CameraSystem"; }
+        SystemAccess GetAccess() const override {
+            return SystemAccess().Read<TransformComponent>().Write<CameraComponent>();
+        }
 
         // Aspect ratio management
         void SetViewportSize(uint32_t width, uint32_t height);
@@ -5,6 +5,7 @@
 #include "ECS/ISystem.h"
 #include "ECS/Scene.h"
 #include <Core/Math/Math.h>
+#include <memory_resource>
 #include <vector>
 
 
@@ -39,6 +40,11 @@ public:
     return 200;
   } // Update after scripts, before rendering
   const char *GetName() const override { return "PhysicsSystem"; }
+  SystemAccess GetAccess() const override {
+    return SystemAccess()
+        .Read<ColliderComponent>()
+        .Write<TransformComponent, RigidBodyComponent>();
+  }
 
   // Settings
   vec3 Gravity = vec3(0.0f, -9.81f, 0.0f);
@@ -47,8 +53,9 @@ public:
 private:
   void IntegrateForces(Scene *scene, float dt);
   void IntegrateVelocity(Scene *scene, float dt);
-  void DetectCollisions(Scene *scene, std::vector<Manifold> &manifolds);
-  void ResolveCollisions(Scene *scene, const std::vector<Manifold> &manifolds);
+  void DetectCollisions(Scene *scene, std::pmr::vector<Manifold> &manifolds);
+  void ResolveCollisions(Scene *scene,
+                         const std::pmr::vector<Manifold> &manifolds);
 
   // Collision primitives
   bool CheckCollision(const TransformComponent &tA, const ColliderComponent &cA,
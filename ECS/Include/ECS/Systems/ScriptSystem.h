@@ -24,6 +24,8 @@ namespace Yamen::ECS {
         void OnShutdown(Scene* scene) override;
         int GetPriority() const override { return 100; } // Update after camera, before rendering
         const char* GetName() const override { return "ScriptSystem"; }
+
+        // Scripts may touch any component or create entities, so keep the default exclusive access
     };
 
 } // namespace Yamen::ECS
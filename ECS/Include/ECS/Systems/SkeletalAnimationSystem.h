@@ -2,24 +2,47 @@
 
 #include "AssetsC3/C3PhyLoader.h"
 #include "ECS/Components/SkeletalAnimationComponent.h"
+#include "ECS/ISystem.h"
 #include <entt/entt.hpp>
 
+namespace Yamen::Core {
+class ThreadPool;
+}
 
 namespace Yamen::ECS {
 
 /**
  * @brief System for updating skeletal animations
  *
- * Updates animation playback and interpolates bone matrices each frame
+ * Updates animation playback and interpolates bone matrices each frame.
+ * Added to a Scene it samples the scene's skeletons on the scene's pool;
+ * Update() does the same for any registry.
  */
-class SkeletalAnimationSystem {
+class SkeletalAnimationSystem : public ISystem {
 public:
+  // ISystem interface
+  void OnUpdate(Scene *scene, float deltaTime) override;
+  int GetPriority() const override { return 200; } // Update before rendering
+  const char *GetName() const override { return "SkeletalAnimationSystem"; }
+  SystemAccess GetAccess() const override {
+    return SystemAccess().Write<SkeletalAnimationComponent>();
+  }
+
   /**
    * @brief Update all skeletal animations
    * @param registry ECS registry
    * @param deltaTime Time since last frame (seconds)
+   * @param threadPool Optional pool to sample skeletons in parallel
+   */
+  static void Update(entt::registry &registry, float deltaTime,
+                     Core::ThreadPool *threadPool = nullptr);
+
+  /**
+   * @brief Advance one animation and rebuild its bone matrices
+   * @param anim Animation component
+   * @param deltaTime Time since last frame (seconds)
    */
-  static void Update(entt::registry &registry, float deltaTime);
+  static void UpdateAnimation(SkeletalAnimationComponent &anim, float deltaTime);
 
   /**
    * @brief Play animation
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "ECS/Components/CoreComponents.h"
+#include "ECS/ISystem.h"
+#include "ECS/Scene.h"
+#include <Core/Math/Math.h>
+#include <cstdint>
+#include <vector>
+
+namespace Yamen::ECS {
+
+    /**
+     * @brief Propagates parent world matrices down HierarchyComponent trees
+     *
+     * Runs after TransformSystem. Nodes live in contiguous arrays, grouped by
+     * root and sorted by depth within each tree, so one forward pass over a tree
+     * visits every parent before its children (breadth-first). Only nodes whose
+     * local matrix changed, and their subtrees, are recomputed; the result is
+     * written to WorldMatrixComponent::Matrix. Independent trees are processed in
+     * parallel on the scene's thread pool.
+     *
+     * The arrays are re-sorted whenever a HierarchyComponent::Parent changes, a
+     * node is added or a node is destroyed.
+     */
+    class TransformHierarchySystem : public ISystem {
+    public:
+        struct Stats {
+            size_t nodeCount = 0;       // Roots and children
+            size_t treeCount = 0;
+            uint32_t maxDepth = 0;
+            size_t updatedCount = 0;    // World matrices recomputed last pass
+            bool rebuilt = false;       // Last pass re-sorted the hierarchy
+        };
+
+        TransformHierarchySystem() = default;
+        ~TransformHierarchySystem() override = default;
+
+        // ISystem interface
+        void OnUpdate(Scene* scene, float deltaTime) override;
+        int GetPriority() const override { return 910; } // Right after TransformSystem
+        const char* GetName() const override { return "TransformHierarchySystem"; }
+        SystemAccess GetAccess() const override {
+            return SystemAccess().Read<HierarchyComponent>().Write<WorldMatrixComponent>();
+        }
+
+        /**
+         * @brief Propagate world matrices now
+         * @return Number of world matrices recomputed
+         */
+        size_t Propagate(Scene* scene);
+
+        const Stats& GetStats() const { return m_Stats; }
+
+    private:
+        static constexpr uint32_t NoParent = UINT32_MAX;
+
+        struct Tree {
+            uint32_t begin = 0;
+            uint32_t end = 0;
+        };
+
+        bool IsStructureValid(const entt::registry& registry) const;
+        void Rebuild(entt::registry& registry);
+        size_t PropagateTree(entt::storage<WorldMatrixComponent>& worlds, const Tree& tree);
+
+        // Per node, grouped by tree and sorted by depth
+        std::vector<entt::entity> m_Entities;
+        std::vector<uint32_t> m_Parents;
+        std::vector<Core::mat4> m_Local;
+        std::vector<Core::mat4> m_World;
+        std::vector<uint8_t> m_Dirty;
+
+        std::vector<Tree> m_Trees;
+        size_t m_ChildCount = 0;        // Entities with a valid Parent, as of the last rebuild
+        bool m_ForceFull = false;       // Recompute every node on the next pass
+        Stats m_Stats;
+    };
+
+} // namespace Yamen::ECS
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "ECS/Components/CoreComponents.h"
+#include "ECS/ISystem.h"
+#include "ECS/Scene.h"
+
+namespace Yamen::ECS {
+
+    /**
+     * @brief Keeps WorldMatrixComponent in sync with TransformComponent
+     *
+     * Runs after gameplay, physics and animation have moved entities. Entities
+     * with a TransformComponent get a WorldMatrixComponent on first sight; each
+     * frame the changed ones are gathered and their matrices rebuilt in one
+     * SIMD batch, so render passes read a cached matrix instead of rebuilding it.
+     */
+    class TransformSystem : public ISystem {
+    public:
+        TransformSystem() = default;
+        ~TransformSystem() override = default;
+
+        // ISystem interface
+        void OnUpdate(Scene* scene, float deltaTime) override;
+        int GetPriority() const override { return 900; } // After simulation, before rendering
+        const char* GetName() const override { return "TransformSystem"; }
+        SystemAccess GetAccess() const override {
+            return SystemAccess().Read<TransformComponent>().Write<WorldMatrixComponent>();
+        }
+
+        /**
+         * @brief Rebuild every changed world matrix in the scene now
+         * @return Number of matrices rebuilt
+         */
+        static size_t UpdateWorldMatrices(Scene* scene);
+    };
+
+} // namespace Yamen::ECS
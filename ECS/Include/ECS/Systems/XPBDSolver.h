@@ -5,7 +5,12 @@
 #include "ECS/Components/PhysicsComponents.h"
 #include "ECS/Components/XPBDComponents.h"
 #include "ECS/ISystem.h"
+#include "ECS/Physics/SpatialHash.h"
+#include "ECS/Physics/XPBDConstraintStore.h"
+#include "ECS/Physics/XPBDParticleStore.h"
 #include "ECS/Scene.h"
+#include <array>
+#include <memory_resource>
 #include <unordered_map>
 #include <vector>
 
@@ -22,7 +27,8 @@ using namespace Yamen::Core;
  * Features:
  * - Time-step independent constraint solving
  * - Compliance-based stiffness control
- * - Unified constraint framework
+ * - Constraints packed by type (XPBDConstraintStore), with separate
+ *   rigid and compliant solve kernels
  * - Warm-starting with Lagrange multipliers
  * - Multi-iteration Gauss-Seidel solver
  *
@@ -48,6 +54,14 @@ public:
 
   int GetPriority() const override { return 200; }
   const char *GetName() const override { return "XPBDSolver"; }
+  // Persistent constraints are reached through their XPBDConstraintComponent
+  // handles, so writing those covers the constraint store
+  SystemAccess GetAccess() const override {
+    return SystemAccess()
+        .Read<ColliderComponent>()
+        .Write<TransformComponent, XPBDParticleComponent,
+               XPBDConstraintComponent>();
+  }
 
   // Configuration
   vec3 Gravity = vec3(0.0f, -9.81f, 0.0f);
@@ -58,53 +72,98 @@ public:
   bool EnableSleeping = true;
   bool EnableWarmStarting = true;
 
+  // Broad phase
+  enum class BroadPhaseMode {
+    AllPairs,   // Test every pair of colliders (reference, O(N^2))
+    SpatialHash // Grid over predicted-position AABBs, rebuilt every substep
+  };
+  BroadPhaseMode BroadPhase = BroadPhaseMode::SpatialHash;
+  float BroadPhaseCellSize = 0.0f; // 0 = fit to a typical collider (90th
+                                   // percentile extent)
+
+  // Parallel solve: persistent constraints are split into colour batches that
+  // share no dynamic particle, re-coloured only when the constraint topology
+  // changes, and each batch runs on the scene's thread pool. Contacts are
+  // coloured every substep; those that need more than MaxContactColors colours
+  // are solved Jacobi-style, averaging their corrections per particle.
+  bool ParallelSolve = false;
+  int MaxContactColors = 8;
+
+  // Particle store: gather the particles into packed arrays once per update,
+  // solve on those with constraints referring to dense indices, and write the
+  // results back at the end. Produces the same results as solving on the
+  // components, bit for bit.
+  bool UseParticleStore = false;
+
   // Statistics
   struct Stats {
     int ActiveParticles = 0;
     int SleepingParticles = 0;
     int ActiveConstraints = 0;
     int ContactConstraints = 0;
+    int BroadPhasePairs = 0; // Candidate pairs passed to the narrow phase
+    int ConstraintColors = 0; // Colour batches of persistent constraints
+    int JacobiContacts = 0;   // Contacts left to the Jacobi fallback
     float SolveTime = 0.0f;
     float CollisionTime = 0.0f;
   };
   Stats GetStats() const { return m_Stats; }
 
 private:
-  // Simulation steps
-  void PredictPositions(Scene *scene, float dt);
-  void GenerateCollisionConstraints(Scene *scene);
-  void SolveConstraints(Scene *scene, float dt);
-  void UpdateVelocities(Scene *scene, float dt);
-  void ApplyFriction(Scene *scene, float dt);
+  // Simulation steps. The templated ones run on either particle access path,
+  // components or packed store (see XPBDSolver.cpp).
+  template <typename Particles>
+  void Substep(Scene *scene, const Particles &particles, float dt);
+  template <typename Particles>
+  void PredictPositions(Scene *scene, const Particles &particles, float dt);
+  template <typename Particles>
+  void GenerateCollisionConstraints(Scene *scene, const Particles &particles);
+  template <typename Particles>
+  void SolveConstraints(Scene *scene, const Particles &particles, float dt);
+  template <typename Particles>
+  void SolveConstraintsParallel(Scene *scene, const Particles &particles,
+                                float dt);
+  template <typename Particles>
+  void UpdateVelocities(Scene *scene, const Particles &particles, float dt);
+  template <typename Particles>
+  void ApplyFriction(const Particles &particles, float dt);
+  void UpdateConstraintColoring(Scene *scene);
+  void ResolveConstraintParticles(Scene *scene);
   void UpdateTransforms(Scene *scene);
   void UpdateSleeping(Scene *scene, float dt);
 
-  // Constraint solving
-  void SolveDistanceConstraint(Scene *scene, DistanceConstraint &constraint,
-                               float dt);
-  void SolveContactConstraint(Scene *scene, ContactConstraint &constraint,
-                              float dt);
-  void SolveBendingConstraint(Scene *scene, BendingConstraint &constraint,
-                              float dt);
-  void SolveVolumeConstraint(Scene *scene, VolumeConstraint &constraint,
-                             float dt);
-  void SolveShapeMatchingConstraint(Scene *scene,
-                                    ShapeMatchingConstraint &constraint,
-                                    float dt);
-  void SolveBallSocketConstraint(Scene *scene, BallSocketConstraint &constraint,
+  // Constraint solving. Persistent constraints are solved by dense index
+  // into their type's array, with the kernel for rigid or compliant ones.
+  template <bool Compliant, typename Particles, typename T>
+  void SolvePersistentConstraint(const Particles &particles,
+                                 XPBDConstraintArray<T> &array, uint32_t index,
                                  float dt);
-  void SolveHingeConstraint(Scene *scene, HingeConstraint &constraint,
-                            float dt);
-  void SolveSliderConstraint(Scene *scene, SliderConstraint &constraint,
-                             float dt);
+  template <bool Compliant, typename Particles, typename T>
+  void SolveConstraintRange(const Particles &particles,
+                            XPBDConstraintArray<T> &array, uint32_t begin,
+                            uint32_t end, float dt);
+  template <typename Particles>
+  void SolveContactConstraint(const Particles &particles, size_t contactIndex,
+                              float dt);
 
   // Collision detection
   struct CollisionPair {
     entt::entity EntityA;
     entt::entity EntityB;
   };
-  void BroadPhaseCollision(Scene *scene, std::vector<CollisionPair> &pairs);
-  bool NarrowPhaseCollision(Scene *scene, const CollisionPair &pair,
+  using CollisionPairList = std::pmr::vector<CollisionPair>;
+  template <typename Particles>
+  void BroadPhaseCollision(Scene *scene, const Particles &particles,
+                           CollisionPairList &pairs);
+  void BroadPhaseAllPairs(Scene *scene, CollisionPairList &pairs);
+  template <typename Particles>
+  void BroadPhaseSpatialHash(Scene *scene, const Particles &particles,
+                             CollisionPairList &pairs);
+  static void ComputeBounds(const ColliderComponent &collider,
+                            const vec3 &position, vec3 &min, vec3 &max);
+  template <typename Particles>
+  bool NarrowPhaseCollision(Scene *scene, const Particles &particles,
+                            const CollisionPair &pair,
                             ContactConstraint &contact);
 
   // Helpers
@@ -113,8 +172,38 @@ private:
                                       const XPBDParticleComponent &p2,
                                       const vec3 &grad1, const vec3 &grad2);
 
+  // Broad-phase grid, reused across substeps and frames
+  SpatialHash m_BroadPhaseGrid;
+
+  // Persistent constraints grouped by type, then rigid before compliant,
+  // then colour: each batch is m_ColoredConstraints[Begin .. End), as indices
+  // into its type's array. The batch of constraints left without a colour is
+  // solved serially.
+  struct ConstraintBatch {
+    XPBDConstraintType Type;
+    bool Compliant;
+    bool Parallel;
+    uint32_t Begin;
+    uint32_t End;
+  };
+  std::vector<uint32_t> m_ColoredConstraints;
+  std::vector<ConstraintBatch> m_ConstraintBatches;
+  uint64_t m_ColoringSignature = 0;
+  bool m_ColoringValid = false;
+
   // Temporary contact constraints (cleared each frame)
-  std::vector<ContactConstraint> m_ContactConstraints;
+  std::pmr::vector<ContactConstraint> m_ContactConstraints;
+
+  // Store path: packed particles, and the dense particle indices of every
+  // persistent constraint and contact. Constraint i of a type has its
+  // particles at Indices[Offsets[i] .. Offsets[i + 1]).
+  struct ResolvedParticles {
+    std::vector<uint32_t> Indices;
+    std::vector<uint32_t> Offsets;
+  };
+  XPBDParticleStore m_ParticleStore;
+  std::array<ResolvedParticles, XPBDConstraintTypeCount> m_ResolvedParticles;
+  std::pmr::vector<uint32_t> m_ContactParticles; // Two per contact
 
   // Statistics
   Stats m_Stats;
@@ -0,0 +1,207 @@
+#include "ECS/EntityCommandBuffer.h"
+#include <Core/Memory/MemoryResources.h>
+#include <algorithm>
+
+namespace Yamen::ECS {
+
+    EntityCommandBuffer::~EntityCommandBuffer() {
+        Reset();
+    }
+
+    DeferredEntity EntityCommandBuffer::Create() {
+        const uint32_t index = m_CreateCount++;
+        Record(CommandType::Create, entt::null, index, nullptr, nullptr, nullptr);
+        return DeferredEntity{ this, index };
+    }
+
+    void EntityCommandBuffer::Destroy(entt::entity entity) {
+        Record(CommandType::Destroy, entity, NoDeferred, nullptr, nullptr, nullptr);
+    }
+
+    void EntityCommandBuffer::Destroy(DeferredEntity entity) {
+        Record(CommandType::Destroy, entt::null, Resolve(entity), nullptr, nullptr, nullptr);
+    }
+
+    uint32_t EntityCommandBuffer::Resolve(DeferredEntity entity) const {
+        if (entity.owner != this || entity.index >= m_CreateCount) {
+            throw std::logic_error("DeferredEntity used with a buffer that did not create it");
+        }
+        return entity.index;
+    }
+
+    void EntityCommandBuffer::Record(CommandType type, entt::entity entity, uint32_t deferred,
+        void* payload, ApplyFn apply, DestroyFn destroy) {
+
+        auto* command = static_cast<Command*>(Allocate(sizeof(Command), alignof(Command)));
+        *command = Command{ nullptr, m_SortKey, static_cast<uint32_t>(m_Count), deferred, entity,
+            type, payload, apply, destroy };
+
+        if (m_Tail) {
+            m_Tail->next = command;
+        }
+        else {
+            m_Head = command;
+        }
+        m_Tail = command;
+        ++m_Count;
+    }
+
+    void* EntityCommandBuffer::Allocate(size_t size, size_t alignment) {
+        if (m_Resource) {
+            return m_Resource->allocate(size, alignment);
+        }
+
+        if (!m_Fallback) {
+            m_Fallback = std::make_unique<std::pmr::monotonic_buffer_resource>(4096);
+        }
+        return m_Fallback->allocate(size, alignment);
+    }
+
+    void EntityCommandBuffer::BindResource(std::pmr::memory_resource* resource) noexcept {
+        if (IsEmpty()) {
+            m_Resource = resource;
+        }
+    }
+
+    void EntityCommandBuffer::Reset() noexcept {
+        for (Command* command = m_Head; command; command = command->next) {
+            if (command->destroy) {
+                command->destroy(command->payload);
+            }
+        }
+
+        m_Head = nullptr;
+        m_Tail = nullptr;
+        m_Count = 0;
+        m_CreateCount = 0;
+        m_SortKey = 0;
+
+        // Frame memory is recycled by its allocator; only the heap arena is ours to release
+        if (m_Fallback) {
+            m_Fallback->release();
+        }
+    }
+
+    EntityCommandBuffer& EntityCommandQueue::GetThreadBuffer(std::pmr::memory_resource* resource) {
+        const uint32_t slot = Core::ThreadSlots::Current();
+
+        EntityCommandBuffer* buffer = nullptr;
+        if (slot == Core::ThreadSlots::NoSlot) {
+            std::lock_guard<std::mutex> lock(m_OverflowMutex);
+            buffer = m_Overflow.emplace_back(std::make_unique<EntityCommandBuffer>()).get();
+        }
+        else {
+            // A slot belongs to one live thread, so only that thread creates its buffer
+            auto& owned = m_Buffers[slot];
+            if (!owned) {
+                owned = std::make_unique<EntityCommandBuffer>();
+            }
+            buffer = owned.get();
+        }
+
+        buffer->BindResource(resource);
+        return *buffer;
+    }
+
+    bool EntityCommandQueue::IsEmpty() const noexcept {
+        for (const auto& buffer : m_Buffers) {
+            if (buffer && !buffer->IsEmpty()) {
+                return false;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_OverflowMutex);
+        return m_Overflow.empty();
+    }
+
+    size_t EntityCommandQueue::Playback(entt::registry& registry) {
+        using Command = EntityCommandBuffer::Command;
+        using CommandType = EntityCommandBuffer::CommandType;
+
+        struct Entry {
+            const Command* command;
+            uint32_t buffer;
+        };
+
+        std::vector<EntityCommandBuffer*> buffers;
+        for (const auto& buffer : m_Buffers) {
+            if (buffer && !buffer->IsEmpty()) {
+                buffers.push_back(buffer.get());
+            }
+        }
+
+        std::vector<std::unique_ptr<EntityCommandBuffer>> overflow;
+        {
+            std::lock_guard<std::mutex> lock(m_OverflowMutex);
+            overflow.swap(m_Overflow);
+        }
+        for (const auto& buffer : overflow) {
+            if (!buffer->IsEmpty()) {
+                buffers.push_back(buffer.get());
+            }
+        }
+
+        if (buffers.empty()) {
+            return 0;
+        }
+
+        size_t total = 0;
+        for (const EntityCommandBuffer* buffer : buffers) {
+            total += buffer->m_Count;
+        }
+
+        std::pmr::vector<Entry> entries(Core::GetScratchResource());
+        entries.reserve(total);
+        std::pmr::vector<std::pmr::vector<entt::entity>> created(Core::GetScratchResource());
+        created.reserve(buffers.size());
+
+        for (uint32_t b = 0; b < buffers.size(); ++b) {
+            for (const Command* command = buffers[b]->m_Head; command; command = command->next) {
+                entries.push_back({ command, b });
+            }
+            created.emplace_back(buffers[b]->m_CreateCount, entt::entity{ entt::null });
+        }
+
+        std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+            if (a.command->sortKey != b.command->sortKey) return a.command->sortKey < b.command->sortKey;
+            if (a.buffer != b.buffer) return a.buffer < b.buffer;
+            return a.command->sequence < b.command->sequence;
+            });
+
+        // Create every deferred entity first, so later commands can target them whatever their keys
+        for (const Entry& entry : entries) {
+            if (entry.command->type == CommandType::Create) {
+                created[entry.buffer][entry.command->deferred] = registry.create();
+            }
+        }
+
+        for (const Entry& entry : entries) {
+            const Command& command = *entry.command;
+            if (command.type == CommandType::Create) {
+                continue;
+            }
+
+            const entt::entity entity = command.deferred == EntityCommandBuffer::NoDeferred
+                ? command.entity
+                : created[entry.buffer][command.deferred];
+
+            if (!registry.valid(entity)) {
+                continue;
+            }
+
+            if (command.type == CommandType::Destroy) {
+                registry.destroy(entity);
+            }
+            else {
+                command.apply(registry, entity, command.payload);
+            }
+        }
+
+        // Runs the destructors of the moved-from payloads
+        for (EntityCommandBuffer* buffer : buffers) {
+            buffer->Reset();
+        }
+        return total;
+    }
+
+} // namespace Yamen::ECS
@@ -6,65 +6,217 @@ namespace Yamen::ECS {
 
 using namespace Yamen::Core;
 
-SpatialHash::SpatialHash(float cellSize) : m_CellSize(cellSize) {}
+namespace {
+
+constexpr size_t MinBucketCount = 16;
+
+size_t NextPowerOfTwo(size_t value) {
+  size_t result = 1;
+  while (result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+
+} // namespace
+
+SpatialHash::SpatialHash(float cellSize)
+    : m_CellSize(cellSize), m_InverseCellSize(1.0f / cellSize) {}
 
 void SpatialHash::Clear() {
-  m_Grid.clear();
-  m_TotalEntries = 0;
+  m_Items.clear();
+  m_EntryCount = 0;
+  m_Built = false;
+}
+
+void SpatialHash::SetCellSize(float cellSize) {
+  Clear();
+  m_CellSize = cellSize;
+  m_InverseCellSize = 1.0f / cellSize;
 }
 
 void SpatialHash::Insert(entt::entity entity, const vec3 &min,
                          const vec3 &max) {
-  CellKey minKey, maxKey;
-  GetCellRange(min, max, minKey, maxKey);
+  Item item{entity, min, max, GetCellKey(min), GetCellKey(max)};
 
-  // Insert entity into all cells it overlaps
-  for (int x = minKey.x; x <= maxKey.x; ++x) {
-    for (int y = minKey.y; y <= maxKey.y; ++y) {
-      for (int z = minKey.z; z <= maxKey.z; ++z) {
-        CellKey key{x, y, z};
-        m_Grid[key].push_back(entity);
-        m_TotalEntries++;
+  m_EntryCount += static_cast<size_t>(item.maxCell.x - item.minCell.x + 1) *
+                  static_cast<size_t>(item.maxCell.y - item.minCell.y + 1) *
+                  static_cast<size_t>(item.maxCell.z - item.minCell.z + 1);
+  m_Items.push_back(item);
+  m_Built = false;
+}
+
+void SpatialHash::Build() { EnsureBuilt(); }
+
+void SpatialHash::EnsureBuilt() const {
+  if (!m_Built) {
+    BuildCells();
+    m_Built = true;
+  }
+}
+
+void SpatialHash::BuildCells() const {
+  // About two buckets per entry keeps unrelated cells from sharing buckets
+  const size_t bucketCount =
+      NextPowerOfTwo(std::max(m_EntryCount * 2, MinBucketCount));
+  m_BucketMask = static_cast<uint32_t>(bucketCount - 1);
+  m_BucketStart.assign(bucketCount + 1, 0);
+  m_Entries.resize(m_EntryCount);
+
+  auto forEachCell = [](const Item &item, auto &&fn) {
+    for (int x = item.minCell.x; x <= item.maxCell.x; ++x) {
+      for (int y = item.minCell.y; y <= item.maxCell.y; ++y) {
+        for (int z = item.minCell.z; z <= item.maxCell.z; ++z) {
+          fn(CellKey{x, y, z});
+        }
       }
     }
+  };
+
+  // Count entries per bucket
+  for (const Item &item : m_Items) {
+    forEachCell(item, [&](const CellKey &key) { ++m_BucketStart[GetBucket(key)]; });
+  }
+
+  // Inclusive prefix sum: m_BucketStart[b] is the end of bucket b
+  for (size_t b = 1; b < bucketCount; ++b) {
+    m_BucketStart[b] += m_BucketStart[b - 1];
+  }
+  m_BucketStart[bucketCount] = static_cast<uint32_t>(m_EntryCount);
+
+  // Scatter back to front, which leaves m_BucketStart[b] at the start of
+  // bucket b and each bucket sorted by item index
+  for (size_t i = m_Items.size(); i-- > 0;) {
+    forEachCell(m_Items[i], [&](const CellKey &key) {
+      m_Entries[--m_BucketStart[GetBucket(key)]] = static_cast<uint32_t>(i);
+    });
   }
 }
 
 void SpatialHash::Query(const vec3 &min, const vec3 &max,
-                        std::vector<entt::entity> &results) const {
-  CellKey minKey, maxKey;
-  GetCellRange(min, max, minKey, maxKey);
-
+                        std::pmr::vector<entt::entity> &results) const {
+  EnsureBuilt();
   results.clear();
 
-  // Query all cells in range
+  const CellKey minKey = GetCellKey(min);
+  const CellKey maxKey = GetCellKey(max);
+
   for (int x = minKey.x; x <= maxKey.x; ++x) {
     for (int y = minKey.y; y <= maxKey.y; ++y) {
       for (int z = minKey.z; z <= maxKey.z; ++z) {
-        CellKey key{x, y, z};
-        auto it = m_Grid.find(key);
-        if (it != m_Grid.end()) {
-          results.insert(results.end(), it->second.begin(), it->second.end());
+        const CellKey key{x, y, z};
+        const uint32_t bucket = GetBucket(key);
+        uint32_t previous = UINT32_MAX;
+
+        for (uint32_t e = m_BucketStart[bucket]; e < m_BucketStart[bucket + 1];
+             ++e) {
+          const uint32_t index = m_Entries[e];
+          if (index == previous)
+            continue; // Same item, another of its cells in this bucket
+          previous = index;
+
+          const Item &item = m_Items[index];
+          if (!Contains(item, key))
+            continue; // Different cell hashed to the same bucket
+
+          // Report each item only from the first cell it shares with the query
+          if (x != std::max(item.minCell.x, minKey.x) ||
+              y != std::max(item.minCell.y, minKey.y) ||
+              z != std::max(item.minCell.z, minKey.z))
+            continue;
+
+          results.push_back(item.entity);
+        }
+      }
+    }
+  }
+}
+
+void SpatialHash::QueryPairs(std::pmr::vector<EntityPair> &pairs) const {
+  EnsureBuilt();
+
+  for (uint32_t i = 0; i < m_Items.size(); ++i) {
+    const Item &item = m_Items[i];
+
+    for (int x = item.minCell.x; x <= item.maxCell.x; ++x) {
+      for (int y = item.minCell.y; y <= item.maxCell.y; ++y) {
+        for (int z = item.minCell.z; z <= item.maxCell.z; ++z) {
+          const CellKey key{x, y, z};
+          const uint32_t bucket = GetBucket(key);
+
+          // Buckets are sorted by item index; only pair with later items
+          const uint32_t *begin = m_Entries.data() + m_BucketStart[bucket];
+          const uint32_t *end = m_Entries.data() + m_BucketStart[bucket + 1];
+          uint32_t previous = UINT32_MAX;
+
+          for (const uint32_t *e = std::upper_bound(begin, end, i); e != end;
+               ++e) {
+            if (*e == previous)
+              continue;
+            previous = *e;
+
+            const Item &other = m_Items[*e];
+            if (!Contains(other, key))
+              continue;
+
+            // Report each pair only from the first cell the two share
+            if (x != std::max(item.minCell.x, other.minCell.x) ||
+                y != std::max(item.minCell.y, other.minCell.y) ||
+                z != std::max(item.minCell.z, other.minCell.z))
+              continue;
+
+            if (item.max.x < other.min.x || other.max.x < item.min.x ||
+                item.max.y < other.min.y || other.max.y < item.min.y ||
+                item.max.z < other.min.z || other.max.z < item.min.z)
+              continue;
+
+            pairs.push_back({item.entity, other.entity});
+          }
         }
       }
     }
   }
+}
+
+int SpatialHash::GetCellCount() const {
+  EnsureBuilt();
 
-  // Remove duplicates (entity might be in multiple cells)
-  std::sort(results.begin(), results.end());
-  results.erase(std::unique(results.begin(), results.end()), results.end());
+  int occupied = 0;
+  for (size_t b = 0; b + 1 < m_BucketStart.size(); ++b) {
+    if (m_BucketStart[b] != m_BucketStart[b + 1]) {
+      ++occupied;
+    }
+  }
+  return occupied;
+}
+
+int SpatialHash::GetTotalEntries() const {
+  return static_cast<int>(m_EntryCount);
 }
 
 SpatialHash::CellKey SpatialHash::GetCellKey(const vec3 &position) const {
-  return CellKey{static_cast<int>(std::floor(position.x / m_CellSize)),
-                 static_cast<int>(std::floor(position.y / m_CellSize)),
-                 static_cast<int>(std::floor(position.z / m_CellSize))};
+  return CellKey{static_cast<int>(std::floor(position.x * m_InverseCellSize)),
+                 static_cast<int>(std::floor(position.y * m_InverseCellSize)),
+                 static_cast<int>(std::floor(position.z * m_InverseCellSize))};
+}
+
+uint32_t SpatialHash::GetBucket(const CellKey &key) const {
+  // Per-axis odd multipliers, then the murmur3 finalizer to mix all bits
+  uint32_t h = static_cast<uint32_t>(key.x) * 0x8da6b343u ^
+               static_cast<uint32_t>(key.y) * 0xd8163841u ^
+               static_cast<uint32_t>(key.z) * 0xcb1ab31fu;
+  h ^= h >> 16;
+  h *= 0x85ebca6bu;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35u;
+  h ^= h >> 16;
+  return h & m_BucketMask;
 }
 
-void SpatialHash::GetCellRange(const vec3 &min, const vec3 &max,
-                               CellKey &minKey, CellKey &maxKey) const {
-  minKey = GetCellKey(min);
-  maxKey = GetCellKey(max);
+bool SpatialHash::Contains(const Item &item, const CellKey &key) {
+  return key.x >= item.minCell.x && key.x <= item.maxCell.x &&
+         key.y >= item.minCell.y && key.y <= item.maxCell.y &&
+         key.z >= item.minCell.z && key.z <= item.maxCell.z;
 }
 
 } // namespace Yamen::ECS
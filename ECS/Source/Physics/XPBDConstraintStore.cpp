@@ -0,0 +1,110 @@
+#include "ECS/Physics/XPBDConstraintStore.h"
+
+namespace Yamen::ECS {
+
+XPBDConstraintStore::XPBDConstraintStore(entt::registry &registry)
+    : m_Registry(&registry) {
+  // The store lives in the registry's context and is destroyed after its
+  // pools, so the connection never outlives it
+  registry.on_destroy<XPBDConstraintComponent>()
+      .connect<&XPBDConstraintStore::OnDestroy>(*this);
+}
+
+XPBDConstraintStore &XPBDConstraintStore::Get(entt::registry &registry) {
+  if (auto *store = registry.ctx().find<XPBDConstraintStore>())
+    return *store;
+  return registry.ctx().emplace<XPBDConstraintStore>(registry);
+}
+
+XPBDConstraintStore *XPBDConstraintStore::Find(entt::registry &registry) {
+  return registry.ctx().find<XPBDConstraintStore>();
+}
+
+XPBDConstraintBase *
+XPBDConstraintStore::GetBase(const XPBDConstraintComponent &handle) {
+  if (!IsValid(handle))
+    return nullptr;
+
+  XPBDConstraintBase *base = nullptr;
+  VisitArray(handle.Type, [&](auto &array) {
+    base = &array.Constraints[m_Slots[handle.Slot].Index];
+  });
+  return base;
+}
+
+size_t XPBDConstraintStore::Size() const {
+  size_t size = 0;
+  std::apply([&](const auto &...arrays) { size = (arrays.Size() + ...); },
+             m_Arrays);
+  return size;
+}
+
+void XPBDConstraintStore::PartitionByCompliance() {
+  ForEachArray([this](auto &array) {
+    uint32_t rigid = 0;
+    uint32_t compliant = array.Size();
+
+    // Swap the first compliant constraint with the last rigid one until the
+    // two ends meet
+    for (;;) {
+      while (rigid < compliant &&
+             array.Constraints[rigid].Compliance == 0.0f)
+        ++rigid;
+      while (rigid < compliant &&
+             array.Constraints[compliant - 1].Compliance != 0.0f)
+        --compliant;
+      if (rigid >= compliant)
+        break;
+
+      Swap(array, rigid++, --compliant);
+    }
+
+    array.RigidCount = rigid;
+  });
+}
+
+uint32_t XPBDConstraintStore::AllocateSlot(XPBDConstraintType type,
+                                           uint32_t index) {
+  uint32_t slot;
+  if (!m_FreeSlots.empty()) {
+    slot = m_FreeSlots.back();
+    m_FreeSlots.pop_back();
+  } else {
+    slot = static_cast<uint32_t>(m_Slots.size());
+    m_Slots.emplace_back();
+  }
+
+  m_Slots[slot] = {index, type, true};
+  return slot;
+}
+
+void XPBDConstraintStore::Remove(uint32_t slot) {
+  if (slot >= m_Slots.size() || !m_Slots[slot].Used)
+    return;
+
+  VisitArray(m_Slots[slot].Type, [&](auto &array) {
+    const uint32_t index = m_Slots[slot].Index;
+    const uint32_t last = array.Size() - 1;
+
+    // Swap-and-pop, repointing the slot of the moved constraint
+    if (index != last) {
+      array.Constraints[index] = std::move(array.Constraints[last]);
+      array.Slots[index] = array.Slots[last];
+      m_Slots[array.Slots[index]].Index = index;
+    }
+    array.Constraints.pop_back();
+    array.Slots.pop_back();
+    if (array.RigidCount > array.Size())
+      array.RigidCount = array.Size();
+  });
+
+  m_Slots[slot].Used = false;
+  m_FreeSlots.push_back(slot);
+}
+
+void XPBDConstraintStore::OnDestroy(entt::registry &registry,
+                                    entt::entity entity) {
+  Remove(registry.get<XPBDConstraintComponent>(entity).Slot);
+}
+
+} // namespace Yamen::ECS
@@ -0,0 +1,42 @@
+#include "ECS/Physics/XPBDParticleStore.h"
+
+namespace Yamen::ECS {
+
+void XPBDParticleStore::Gather(
+    const entt::storage<XPBDParticleComponent> &particles) {
+  const size_t count = particles.size();
+  const entt::entity *entities = particles.data();
+
+  m_Particles = &particles;
+  Positions.resize(count);
+  PreviousPositions.resize(count);
+  Velocities.resize(count);
+  ExternalForces.resize(count);
+  InverseMasses.resize(count);
+  Sleeping.resize(count);
+
+  for (size_t i = 0; i < count; ++i) {
+    const auto &particle = particles.get(entities[i]);
+    Positions[i] = particle.Position;
+    PreviousPositions[i] = particle.PreviousPosition;
+    Velocities[i] = particle.Velocity;
+    ExternalForces[i] = particle.ExternalForce;
+    InverseMasses[i] = particle.InverseMass;
+    Sleeping[i] = particle.IsSleeping ? 1 : 0;
+  }
+}
+
+void XPBDParticleStore::Scatter(
+    entt::storage<XPBDParticleComponent> &particles) const {
+  const entt::entity *entities = particles.data();
+
+  for (size_t i = 0; i < Positions.size(); ++i) {
+    auto &particle = particles.get(entities[i]);
+    particle.Position = Positions[i];
+    particle.PreviousPosition = PreviousPositions[i];
+    particle.Velocity = Velocities[i];
+    particle.ExternalForce = ExternalForces[i];
+  }
+}
+
+} // namespace Yamen::ECS
@@ -1,8 +1,12 @@
 #include "ECS/Scene.h"
 #include "ECS/Entity.h"
+#include "ECS/EntityCommandBuffer.h"
 #include "ECS/Components.h"
 #include "ECS/ISystem.h"
 #include <Core/Logging/Logger.h>
+#include <Core/Memory/FrameAllocator.h>
+#include <Core/Memory/MemoryResources.h>
+#include <Core/Threading/JobSystem.h>
 #include <algorithm>
 
 namespace Yamen::ECS {
@@ -11,6 +15,7 @@ namespace Yamen::ECS {
         : m_Name(name)
         , m_Active(true)
         , m_SystemsDirty(false)
+        , m_Commands(std::make_unique<EntityCommandQueue>())
     {
         YAMEN_CORE_INFO("Created scene: {}", m_Name);
     }
@@ -55,9 +60,79 @@ namespace Yamen::ECS {
             SortSystems();
         }
 
-        for (auto& system : m_Systems) {
-            system->OnUpdate(this, deltaTime);
+        // Systems build their per-frame containers on the scratch resource
+        Core::ScopedScratchResource scratch(m_FrameAllocator);
+
+        // Sync points: commands recorded since the last update, then after every phase
+        PlaybackCommands();
+
+        // Cleared on the way out even if a system throws
+        struct UpdatingScope {
+            bool& updating;
+            ~UpdatingScope() { updating = false; }
+        } updatingScope{ m_Updating };
+        m_Updating = true;
+
+        size_t begin = 0;
+        for (size_t end : m_SystemPhaseEnds) {
+            if (m_ThreadPool && end - begin > 1) {
+                UpdateSystemsParallel(begin, end, deltaTime);
+            }
+            else {
+                for (size_t i = begin; i < end; ++i) {
+                    m_Systems[i]->OnUpdate(this, deltaTime);
+                }
+            }
+
+            PlaybackCommands();
+            begin = end;
+        }
+    }
+
+    void Scene::UpdateSystemsParallel(size_t begin, size_t end, float deltaTime) {
+        for (size_t i = begin; i < end; ++i) {
+            m_SystemAccess[i].AssureStorage(m_Registry);
+        }
+
+        // Each system waits for the earlier, higher-priority systems it conflicts with
+        Core::JobSystem jobs(*m_ThreadPool);
+        std::vector<Core::JobHandle> handles;
+        handles.reserve(end - begin);
+
+        for (size_t i = begin; i < end; ++i) {
+            ISystem* system = m_Systems[i].get();
+            Core::FrameAllocator* frameAllocator = m_FrameAllocator;
+
+            Core::JobHandle job = jobs.Create([this, system, frameAllocator, deltaTime] {
+                Core::ScopedScratchResource scratch(frameAllocator);
+                system->OnUpdate(this, deltaTime);
+                });
+
+            for (uint32_t dependency : m_SystemDependencies[i]) {
+                if (dependency >= begin) {
+                    jobs.AddDependency(job, handles[dependency - begin]);
+                }
+            }
+            handles.push_back(job);
         }
+
+        jobs.SubmitBatch(handles);
+        jobs.WaitAll(handles);
+
+        for (size_t i = begin; i < end; ++i) {
+            if (handles[i - begin].HasFailed()) {
+                YAMEN_CORE_ERROR("System {} failed during parallel update", m_Systems[i]->GetName());
+            }
+        }
+    }
+
+    EntityCommandBuffer& Scene::GetCommandBuffer() {
+        // Frame memory only while the update that plays the commands back is running
+        return m_Commands->GetThreadBuffer(m_Updating ? m_FrameAllocator : nullptr);
+    }
+
+    size_t Scene::PlaybackCommands() {
+        return m_Commands->Playback(m_Registry);
     }
 
     void Scene::OnRender() {
@@ -67,6 +142,8 @@ namespace Yamen::ECS {
             SortSystems();
         }
 
+        Core::ScopedScratchResource scratch(m_FrameAllocator);
+
         for (auto& system : m_Systems) {
             system->OnRender(this);
         }
@@ -77,14 +154,46 @@ namespace Yamen::ECS {
             system->OnShutdown(this);
         }
         m_Systems.clear();
+        m_SystemAccess.clear();
+        m_SystemDependencies.clear();
+        m_SystemPhaseEnds.clear();
+        m_Commands->Playback(m_Registry);
         m_Registry.clear();
     }
 
     void Scene::SortSystems() {
-        std::sort(m_Systems.begin(), m_Systems.end(),
+        // Stable, so systems of equal priority keep the order they were added in
+        std::stable_sort(m_Systems.begin(), m_Systems.end(),
             [](const std::unique_ptr<ISystem>& a, const std::unique_ptr<ISystem>& b) {
                 return a->GetPriority() < b->GetPriority();
             });
+
+        m_SystemAccess.clear();
+        m_SystemAccess.reserve(m_Systems.size());
+        for (auto& system : m_Systems) {
+            m_SystemAccess.push_back(system->GetAccess());
+        }
+
+        m_SystemDependencies.assign(m_Systems.size(), {});
+        for (uint32_t i = 0; i < m_Systems.size(); ++i) {
+            for (uint32_t j = 0; j < i; ++j) {
+                if (m_SystemAccess[i].ConflictsWith(m_SystemAccess[j])) {
+                    m_SystemDependencies[i].push_back(j);
+                }
+            }
+        }
+
+        // Phases: each exclusive system alone, and each run of declared systems between them
+        m_SystemPhaseEnds.clear();
+        for (size_t i = 0; i < m_Systems.size(); ++i) {
+            const bool endsHere = i + 1 == m_Systems.size()
+                || m_SystemAccess[i].IsExclusive()
+                || m_SystemAccess[i + 1].IsExclusive();
+            if (endsHere) {
+                m_SystemPhaseEnds.push_back(i + 1);
+            }
+        }
+
         m_SystemsDirty = false;
     }
 
@@ -1,6 +1,9 @@
 #include "ECS/Systems/PhysicsSystem.h"
 #include "ECS/Components.h"
+#include "ECS/ParallelForEach.h"
 #include <Core/Logging/Logger.h>
+#include <Core/Memory/MemoryTracker.h>
+#include <Core/Memory/StackAllocator.h>
 #include <cmath>
 
 namespace Yamen::ECS {
@@ -15,12 +18,14 @@ void PhysicsSystem::OnUpdate(Scene *scene, float deltaTime) {
   if (!scene)
     return;
 
+  ScopedMemoryTag memoryTag(MemoryTag::Physics);
   float dt = deltaTime / (float)SubSteps;
 
   for (int step = 0; step < SubSteps; ++step) {
     IntegrateForces(scene, dt);
 
-    std::vector<Manifold> manifolds;
+    StackScope scratch;
+    std::pmr::vector<Manifold> manifolds(scratch.GetResource());
     DetectCollisions(scene, manifolds);
     ResolveCollisions(scene, manifolds);
 
@@ -37,49 +42,49 @@ void PhysicsSystem::OnShutdown(Scene *scene) {
 }
 
 void PhysicsSystem::IntegrateForces(Scene *scene, float dt) {
-  auto view = scene->Registry().view<RigidBodyComponent>();
-  for (auto entity : view) {
-    auto &body = view.get<RigidBodyComponent>(entity);
+  const vec3 gravity = Gravity;
 
-    if (body.Type != BodyType::Dynamic || body.IsSleeping)
-      continue;
+  ParallelForEach<RigidBodyComponent>(
+      scene->GetThreadPool(), scene->Registry(),
+      [gravity, dt](entt::entity, RigidBodyComponent &body) {
+        if (body.Type != BodyType::Dynamic || body.IsSleeping)
+          return;
 
-    // Apply Gravity
-    if (body.UseGravity) {
-      body.AddForce(Gravity * body.Mass);
-    }
+        // Apply Gravity
+        if (body.UseGravity) {
+          body.AddForce(gravity * body.Mass);
+        }
 
-    // F = ma -> a = F/m
-    vec3 acceleration = body.Force * body.GetInverseMass();
+        // F = ma -> a = F/m
+        vec3 acceleration = body.Force * body.GetInverseMass();
 
-    // Integrate Velocity: v += a * dt
-    body.Velocity += acceleration * dt;
+        // Integrate Velocity: v += a * dt
+        body.Velocity += acceleration * dt;
 
-    // Apply Drag (simplified linear drag)
-    body.Velocity *= (1.0f - body.LinearDrag);
+        // Apply Drag (simplified linear drag)
+        body.Velocity *= (1.0f - body.LinearDrag);
 
-    // Clear forces
-    body.Force = vec3(0.0f);
-    body.Torque = vec3(0.0f);
-  }
+        // Clear forces
+        body.Force = vec3(0.0f);
+        body.Torque = vec3(0.0f);
+      });
 }
 
 void PhysicsSystem::IntegrateVelocity(Scene *scene, float dt) {
-  auto view = scene->Registry().view<TransformComponent, RigidBodyComponent>();
-  for (auto entity : view) {
-    auto [transform, body] =
-        view.get<TransformComponent, RigidBodyComponent>(entity);
-
-    if (body.Type == BodyType::Static || body.IsSleeping)
-      continue;
-
-    // Integrate Position: p += v * dt
-    transform.Translation += body.Velocity * dt;
-  }
+  ParallelForEach<RigidBodyComponent, TransformComponent>(
+      scene->GetThreadPool(), scene->Registry(),
+      [dt](entt::entity, RigidBodyComponent &body,
+           TransformComponent &transform) {
+        if (body.Type == BodyType::Static || body.IsSleeping)
+          return;
+
+        // Integrate Position: p += v * dt
+        transform.Translation += body.Velocity * dt;
+      });
 }
 
 void PhysicsSystem::DetectCollisions(Scene *scene,
-                                     std::vector<Manifold> &manifolds) {
+                                     std::pmr::vector<Manifold> &manifolds) {
   auto view = scene->Registry().view<TransformComponent, ColliderComponent>();
 
   // Naive O(N^2) broadphase for now - optimize with QuadTree later
@@ -118,8 +123,8 @@ void PhysicsSystem::DetectCollisions(Scene *scene,
   }
 }
 
-void PhysicsSystem::ResolveCollisions(Scene *scene,
-                                      const std::vector<Manifold> &manifolds) {
+void PhysicsSystem::ResolveCollisions(
+    Scene *scene, const std::pmr::vector<Manifold> &manifolds) {
   for (const auto &m : manifolds) {
     RigidBodyComponent *b1 =
         scene->Registry().try_get<RigidBodyComponent>(m.EntityA);
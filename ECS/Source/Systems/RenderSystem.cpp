@@ -2,6 +2,7 @@
 #include "ECS/Components.h"
 #include <Core/Logging/Logger.h>
 #include <Core/Math/Math.h>
+#include <Core/Memory/MemoryResources.h>
 #include <algorithm>
 #include <entt/entt.hpp>
 
@@ -10,6 +11,17 @@ namespace Yamen::ECS {
 
 using namespace Core::Math;
 
+namespace {
+
+// Cached by TransformSystem; built on the spot for scenes that don't run it
+mat4 WorldMatrixOf(const entt::registry &reg, entt::entity entity,
+                   const TransformComponent &transform) {
+  const auto *world = reg.try_get<WorldMatrixComponent>(entity);
+  return world ? world->Matrix : transform.GetTransform();
+}
+
+} // namespace
+
 RenderSystem::RenderSystem(Graphics::GraphicsDevice &device,
                            Graphics::Renderer3D *renderer3D,
                            Graphics::Renderer2D *renderer2D)
@@ -115,8 +127,8 @@ void RenderSystem::RenderShadowPass(Scene *scene, Graphics::Camera3D *camera) {
     if (!mesh.Visible || !mesh.CastShadows || !mesh.Mesh)
       continue;
 
-    m_Renderer3D->DrawMeshWithSubMeshes(mesh.Mesh.get(),
-                                        transform.GetTransform());
+    m_Renderer3D->DrawMeshWithSubMeshes(
+        mesh.Mesh.get(), WorldMatrixOf(reg, entity, transform));
   }
 
   m_Renderer3D->EndShadowPass();
@@ -161,7 +173,8 @@ void RenderSystem::RenderOpaquePass(Scene *scene, Graphics::Camera3D *camera) {
     mat4 transform;
   };
 
-  std::vector<MeshRenderData> renderQueue;
+  // Per-frame scratch: lives in the scene's frame allocator when it has one
+  std::pmr::vector<MeshRenderData> renderQueue(Core::GetScratchResource());
   renderQueue.reserve(200); // Pre-allocate for typical scene size
 
   // Collect all visible meshes
@@ -174,7 +187,7 @@ void RenderSystem::RenderOpaquePass(Scene *scene, Graphics::Camera3D *camera) {
       continue;
 
     renderQueue.push_back({entity, mesh.Mesh.get(), mesh.Material.get(),
-                           transform.GetTransform()});
+                           WorldMatrixOf(reg, entity, transform)});
   }
 
   // Sort by material pointer to batch same materials together
@@ -235,7 +248,8 @@ void RenderSystem::RenderTransparentPass(Scene *scene,
     auto &transform = meshView.get<TransformComponent>(item.entity);
     auto &mesh = meshView.get<MeshComponent>(item.entity);
 
-    m_Renderer3D->DrawMesh(mesh.Mesh.get(), transform.GetTransform(),
+    m_Renderer3D->DrawMesh(mesh.Mesh.get(),
+                           WorldMatrixOf(reg, item.entity, transform),
                            mesh.Material.get());
   }
 }
@@ -1,55 +1,74 @@
 #include "ECS/Systems/SkeletalAnimationSystem.h"
 #include "Core/Logging/Logger.h"
+#include "Core/Memory/MemoryTracker.h"
+#include "ECS/ParallelForEach.h"
+#include "ECS/Scene.h"
 
 namespace Yamen::ECS {
 
+void SkeletalAnimationSystem::OnUpdate(Scene *scene, float deltaTime) {
+  if (!scene)
+    return;
+
+  Update(scene->Registry(), deltaTime, scene->GetThreadPool());
+}
+
 void SkeletalAnimationSystem::Update(entt::registry &registry,
-                                     float deltaTime) {
-  auto view = registry.view<SkeletalAnimationComponent>();
+                                     float deltaTime,
+                                     Core::ThreadPool *threadPool) {
+  // Each entity samples a whole skeleton, so a few entities per chunk is enough
+  ParallelForEach<SkeletalAnimationComponent>(
+      threadPool, registry,
+      [deltaTime](entt::entity, SkeletalAnimationComponent &anim) {
+        // Runs on pool workers, so the tag is set per call rather than once
+        Core::ScopedMemoryTag memoryTag(Core::MemoryTag::Animation);
+        UpdateAnimation(anim, deltaTime);
+      },
+      threadPool ? 4 : 0);
+}
 
-  for (auto entity : view) {
-    auto &anim = view.get<SkeletalAnimationComponent>(entity);
+void SkeletalAnimationSystem::UpdateAnimation(SkeletalAnimationComponent &anim,
+                                              float deltaTime) {
+  if (!anim.motion || !anim.isPlaying) {
+    return;
+  }
 
-    if (!anim.motion || !anim.isPlaying) {
-      continue;
-    }
+  // Advance frame
+  anim.currentFrame += anim.playbackSpeed * deltaTime;
 
-    // Advance frame
-    anim.currentFrame += anim.playbackSpeed * deltaTime;
-
-    // Handle looping
-    if (anim.currentFrame >= anim.motion->frameCount) {
-      if (anim.loop) {
-        anim.currentFrame = fmod(anim.currentFrame,
-                                 static_cast<float>(anim.motion->frameCount));
-      } else {
-        anim.currentFrame = static_cast<float>(anim.motion->frameCount - 1);
-        anim.isPlaying = false;
-      }
+  // Handle looping
+  if (anim.currentFrame >= anim.motion->frameCount) {
+    if (anim.loop) {
+      anim.currentFrame = fmod(anim.currentFrame,
+                               static_cast<float>(anim.motion->frameCount));
+    } else {
+      anim.currentFrame = static_cast<float>(anim.motion->frameCount - 1);
+      anim.isPlaying = false;
     }
+  }
 
-    // Interpolate bone matrices for current frame (Global Transforms)
-    Assets::C3PhyLoader::InterpolateBones(*anim.motion, anim.currentFrame,
-                                          anim.boneMatrices);
+  // Interpolate bone matrices for current frame (Global Transforms)
+  Assets::C3PhyLoader::InterpolateBones(*anim.motion, anim.currentFrame,
+                                        anim.boneMatrices);
 
-    // Ensure finalBoneMatrices is resized
-    if (anim.finalBoneMatrices.size() != anim.boneMatrices.size()) {
-      anim.finalBoneMatrices.resize(anim.boneMatrices.size());
-    }
+  // Ensure finalBoneMatrices is resized
+  if (anim.finalBoneMatrices.size() != anim.boneMatrices.size()) {
+    anim.finalBoneMatrices.resize(anim.boneMatrices.size());
+  }
 
-    // User's working order: InvBind * Global
-    // (This was manually tested and worked)
+  // User's working order: InvBind * Global
+  // (This was manually tested and worked)
 // Apply InvBind: finalMatrix = Global * InvBind
-    for (size_t i = 0; i < anim.boneMatrices.size(); ++i) {
-        if (i < anim.inverseBindMatrices.size()) {
-            anim.finalBoneMatrices[i] = anim.boneMatrices[i] * anim.inverseBindMatrices[i];
-        }
-        else {
-            anim.finalBoneMatrices[i] = anim.boneMatrices[i];
-        }
-    }
+  for (size_t i = 0; i < anim.boneMatrices.size(); ++i) {
+      if (i < anim.inverseBindMatrices.size()) {
+          anim.finalBoneMatrices[i] = anim.boneMatrices[i] * anim.inverseBindMatrices[i];
+      }
+      else {
+          anim.finalBoneMatrices[i] = anim.boneMatrices[i];
+      }
   }
 }
+
 void SkeletalAnimationSystem::Play(SkeletalAnimationComponent &anim,
                                    bool fromStart) {
   if (fromStart) {
@@ -0,0 +1,273 @@
+#include "ECS/Systems/TransformHierarchySystem.h"
+#include <Core/Logging/Logger.h>
+#include <Core/Memory/MemoryTracker.h>
+#include <Core/Threading/ParallelFor.h>
+#include <algorithm>
+#include <atomic>
+#include <unordered_map>
+
+namespace Yamen::ECS {
+
+    void TransformHierarchySystem::OnUpdate(Scene* scene, float deltaTime) {
+        if (!scene) return;
+
+        Core::ScopedMemoryTag memoryTag(Core::MemoryTag::ECS);
+        Propagate(scene);
+    }
+
+    size_t TransformHierarchySystem::Propagate(Scene* scene) {
+        auto& registry = scene->Registry();
+
+        m_Stats.rebuilt = !IsStructureValid(registry);
+        if (m_Stats.rebuilt) {
+            Rebuild(registry);
+        }
+
+        m_Stats.updatedCount = 0;
+        if (m_Trees.empty()) {
+            return 0;
+        }
+
+        // Looked up once: the storage is only read from the workers
+        auto& worlds = registry.storage<WorldMatrixComponent>();
+        std::atomic<size_t> updated{ 0 };
+
+        auto processTrees = [&](size_t begin, size_t end) {
+            size_t count = 0;
+            for (size_t i = begin; i < end; ++i) {
+                count += PropagateTree(worlds, m_Trees[i]);
+            }
+            updated.fetch_add(count, std::memory_order_relaxed);
+        };
+
+        Core::ThreadPool* pool = scene->GetThreadPool();
+        if (!pool || m_Trees.size() == 1 || m_Entities.size() < Core::ParallelForSettings::SerialThreshold) {
+            processTrees(0, m_Trees.size());
+        }
+        else {
+            const size_t grainSize = Core::ComputeGrainSize(m_Trees.size(), pool->GetThreadCount() + 1);
+            Core::ParallelForChunked(*pool, Core::IndexRange{ 0, m_Trees.size() }, grainSize, processTrees);
+        }
+
+        m_ForceFull = false;
+        m_Stats.updatedCount = updated.load(std::memory_order_relaxed);
+        return m_Stats.updatedCount;
+    }
+
+    bool TransformHierarchySystem::IsStructureValid(const entt::registry& registry) const {
+        size_t childCount = 0;
+        auto view = registry.view<HierarchyComponent>();
+        for (auto entity : view) {
+            if (registry.valid(view.get<HierarchyComponent>(entity).Parent)) {
+                ++childCount;
+            }
+        }
+        if (childCount != m_ChildCount) {
+            return false;
+        }
+
+        for (size_t i = 0; i < m_Entities.size(); ++i) {
+            if (!registry.valid(m_Entities[i])) {
+                return false;
+            }
+            if (m_Parents[i] == NoParent) {
+                continue;
+            }
+
+            const auto* hierarchy = registry.try_get<HierarchyComponent>(m_Entities[i]);
+            if (!hierarchy || hierarchy->Parent != m_Entities[m_Parents[i]]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void TransformHierarchySystem::Rebuild(entt::registry& registry) {
+        // Parent of every attached entity
+        std::unordered_map<entt::entity, entt::entity> parents;
+        auto view = registry.view<HierarchyComponent>();
+        for (auto entity : view) {
+            const entt::entity parent = view.get<HierarchyComponent>(entity).Parent;
+            if (registry.valid(parent)) {
+                parents.emplace(entity, parent);
+            }
+        }
+        m_ChildCount = parents.size();
+
+        // Root and depth of every node, resolved by walking up each parent chain once
+        struct Node {
+            entt::entity root;
+            uint32_t depth;
+            entt::entity entity;
+        };
+
+        std::vector<Node> nodes;
+        nodes.reserve(parents.size() + parents.size() / 4);
+        std::unordered_map<entt::entity, std::pair<entt::entity, uint32_t>> resolved;
+        resolved.reserve(nodes.capacity());
+        std::vector<entt::entity> chain;
+        size_t cyclicCount = 0;
+
+        for (const auto& [child, parent] : parents) {
+            chain.clear();
+            entt::entity current = child;
+            entt::entity root = entt::null;
+            uint32_t depth = 0;
+
+            while (true) {
+                if (auto it = resolved.find(current); it != resolved.end()) {
+                    root = it->second.first;
+                    depth = it->second.second;
+                    break;
+                }
+
+                auto up = parents.find(current);
+                if (up == parents.end()) {
+                    root = current;
+                    resolved.emplace(current, std::make_pair(current, 0u));
+                    nodes.push_back({ current, 0, current });
+                    break;
+                }
+
+                chain.push_back(current);
+                if (chain.size() > parents.size()) {
+                    break;  // Parent cycle
+                }
+                current = up->second;
+            }
+
+            if (root == entt::null) {
+                ++cyclicCount;
+                continue;
+            }
+
+            for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+                resolved.emplace(*it, std::make_pair(root, ++depth));
+                nodes.push_back({ root, depth, *it });
+            }
+        }
+
+        if (cyclicCount > 0) {
+            YAMEN_CORE_WARN("TransformHierarchySystem: {} entities are in a parent cycle and were skipped", cyclicCount);
+        }
+
+        // Trees contiguous, each sorted by depth so parents precede their children
+        std::sort(nodes.begin(), nodes.end(), [](const Node& a, const Node& b) {
+            if (a.root != b.root) return entt::to_integral(a.root) < entt::to_integral(b.root);
+            if (a.depth != b.depth) return a.depth < b.depth;
+            return entt::to_integral(a.entity) < entt::to_integral(b.entity);
+            });
+
+        // Keep local matrices of nodes that were already tracked
+        std::unordered_map<entt::entity, uint32_t> previous;
+        previous.reserve(m_Entities.size());
+        for (uint32_t i = 0; i < m_Entities.size(); ++i) {
+            previous.emplace(m_Entities[i], i);
+        }
+
+        auto& worlds = registry.storage<WorldMatrixComponent>();
+        const size_t count = nodes.size();
+
+        std::vector<entt::entity> entities(count);
+        std::vector<uint32_t> parentIndices(count);
+        std::vector<Core::mat4> locals(count);
+        std::unordered_map<entt::entity, uint32_t> indices;
+        indices.reserve(count);
+
+        m_Trees.clear();
+        m_Stats.maxDepth = 0;
+
+        for (uint32_t i = 0; i < count; ++i) {
+            const Node& node = nodes[i];
+            entities[i] = node.entity;
+            indices.emplace(node.entity, i);
+
+            if (node.depth == 0) {
+                if (!m_Trees.empty()) {
+                    m_Trees.back().end = i;
+                }
+                m_Trees.push_back({ i, i });
+                parentIndices[i] = NoParent;
+            }
+            else {
+                parentIndices[i] = indices.at(parents.at(node.entity));
+            }
+            m_Stats.maxDepth = std::max(m_Stats.maxDepth, node.depth);
+
+            // A newly tracked node's matrix is still its local one
+            if (auto it = previous.find(node.entity); it != previous.end()) {
+                locals[i] = m_Local[it->second];
+
+                // A former child that now roots its own tree drops its old parent's
+                // transform; roots are not written by propagation
+                if (node.depth == 0 && m_Parents[it->second] != NoParent && worlds.contains(node.entity)) {
+                    auto& world = worlds.get(node.entity);
+                    if (!world.LocalChanged) {
+                        world.Matrix = locals[i];
+                    }
+                }
+                previous.erase(it);
+            }
+            else if (worlds.contains(node.entity)) {
+                locals[i] = worlds.get(node.entity).Matrix;
+            }
+        }
+        if (!m_Trees.empty()) {
+            m_Trees.back().end = static_cast<uint32_t>(count);
+        }
+
+        // Detached children fall back to their local matrix
+        for (const auto& [entity, index] : previous) {
+            if (m_Parents[index] != NoParent && registry.valid(entity) && worlds.contains(entity)) {
+                auto& world = worlds.get(entity);
+                if (!world.LocalChanged) {
+                    world.Matrix = m_Local[index];
+                }
+            }
+        }
+
+        m_Entities = std::move(entities);
+        m_Parents = std::move(parentIndices);
+        m_Local = std::move(locals);
+        m_World.resize(count);
+        m_Dirty.assign(count, 0);
+        m_ForceFull = true;
+
+        m_Stats.nodeCount = count;
+        m_Stats.treeCount = m_Trees.size();
+    }
+
+    size_t TransformHierarchySystem::PropagateTree(entt::storage<WorldMatrixComponent>& worlds, const Tree& tree) {
+        size_t updated = 0;
+
+        for (uint32_t i = tree.begin; i < tree.end; ++i) {
+            WorldMatrixComponent* world = worlds.contains(m_Entities[i]) ? &worlds.get(m_Entities[i]) : nullptr;
+
+            bool dirty = m_ForceFull;
+            if (world && world->LocalChanged) {
+                m_Local[i] = world->Matrix;
+                world->LocalChanged = false;
+                dirty = true;
+            }
+
+            const uint32_t parent = m_Parents[i];
+            if (parent == NoParent) {
+                if (dirty) {
+                    m_World[i] = m_Local[i];
+                }
+            }
+            else if (dirty || m_Dirty[parent]) {
+                dirty = true;
+                m_World[i] = m_Local[i] * m_World[parent];
+                if (world) {
+                    world->Matrix = m_World[i];
+                }
+                ++updated;
+            }
+
+            m_Dirty[i] = dirty;
+        }
+        return updated;
+    }
+
+} // namespace Yamen::ECS
@@ -0,0 +1,68 @@
+#include "ECS/Systems/TransformSystem.h"
+#include "ECS/Components/CoreComponents.h"
+#include <Core/Math/SIMDMath.h>
+#include <Core/Memory/MemoryResources.h>
+#include <Core/Memory/MemoryTracker.h>
+#include <entt/entt.hpp>
+#include <memory_resource>
+
+namespace Yamen::ECS {
+
+    void TransformSystem::OnUpdate(Scene* scene, float deltaTime) {
+        if (!scene) return;
+
+        Core::ScopedMemoryTag memoryTag(Core::MemoryTag::ECS);
+        UpdateWorldMatrices(scene);
+    }
+
+    size_t TransformSystem::UpdateWorldMatrices(Scene* scene) {
+        auto& registry = scene->Registry();
+        std::pmr::memory_resource* scratch = Core::GetScratchResource();
+
+        // Entities created since the last pass
+        auto missing = registry.view<TransformComponent>(entt::exclude<WorldMatrixComponent>);
+        std::pmr::vector<entt::entity> added(scratch);
+        added.assign(missing.begin(), missing.end());
+        for (auto entity : added) {
+            registry.emplace<WorldMatrixComponent>(entity);
+        }
+
+        // Gather changed transforms into packed arrays for the batch kernel
+        std::pmr::vector<WorldMatrixComponent*> targets(scratch);
+        std::pmr::vector<vec3> translations(scratch);
+        std::pmr::vector<quat> rotations(scratch);
+        std::pmr::vector<vec3> scales(scratch);
+
+        auto view = registry.view<TransformComponent, WorldMatrixComponent>();
+        for (auto entity : view) {
+            auto [transform, world] = view.get<TransformComponent, WorldMatrixComponent>(entity);
+            if (!world.Dirty && world.Matches(transform)) {
+                continue;
+            }
+
+            world.Translation = transform.Translation;
+            world.Rotation = transform.Rotation;
+            world.Scale = transform.Scale;
+            world.Dirty = false;
+            world.LocalChanged = true;
+
+            targets.push_back(&world);
+            translations.push_back(transform.Translation);
+            rotations.push_back(transform.Rotation);
+            scales.push_back(transform.Scale);
+        }
+
+        if (targets.empty()) {
+            return 0;
+        }
+
+        std::pmr::vector<mat4> matrices(targets.size(), scratch);
+        Core::simd::ComposeTransforms(translations, rotations, scales, matrices);
+
+        for (size_t i = 0; i < targets.size(); ++i) {
+            targets[i]->Matrix = matrices[i];
+        }
+        return targets.size();
+    }
+
+} // namespace Yamen::ECS
@@ -2,196 +2,158 @@
 #include "ECS/Components.h"
 #include <Core/Logging/Logger.h>
 #include <Core/Math/Math.h>
+#include <Core/Memory/MemoryResources.h>
+#include <Core/Memory/MemoryTracker.h>
+#include <Core/Memory/StackAllocator.h>
+#include <Core/Threading/ParallelFor.h>
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <chrono>
 
 namespace Yamen::ECS {
 
 using namespace Core::Math;
 
-XPBDSolver::XPBDSolver() {}
-
-XPBDSolver::~XPBDSolver() {}
-
-void XPBDSolver::OnInit(Scene *scene) {
-  YAMEN_CORE_INFO("XPBD Solver initialized");
-  YAMEN_CORE_INFO("  SubSteps: {}", SubSteps);
-  YAMEN_CORE_INFO("  Solver Iterations: {}", SolverIterations);
-}
-
-void XPBDSolver::OnUpdate(Scene *scene, float deltaTime) {
-  if (!scene)
-    return;
-
-  auto startTime = std::chrono::high_resolution_clock::now();
-
-  // Reset statistics
-  m_Stats = Stats();
-
-  // Substep the simulation for stability
-  float dt = deltaTime / static_cast<float>(SubSteps);
-
-  for (int substep = 0; substep < SubSteps; ++substep) {
-    // 1. Predict positions using external forces
-    PredictPositions(scene, dt);
-
-    // 2. Generate collision constraints
-    auto collisionStart = std::chrono::high_resolution_clock::now();
-    GenerateCollisionConstraints(scene);
-    auto collisionEnd = std::chrono::high_resolution_clock::now();
-    m_Stats.CollisionTime =
-        std::chrono::duration<float, std::milli>(collisionEnd - collisionStart)
-            .count();
+namespace {
 
-    // 3. Solve all constraints iteratively
-    auto solveStart = std::chrono::high_resolution_clock::now();
-    SolveConstraints(scene, dt);
-    auto solveEnd = std::chrono::high_resolution_clock::now();
-    m_Stats.SolveTime =
-        std::chrono::duration<float, std::milli>(solveEnd - solveStart).count();
+// Particle access for the solver steps. ComponentParticles works on the
+// particle components and finds a constraint's particles by entity;
+// StoreParticles works on the arrays of an XPBDParticleStore, with particle
+// indices resolved once per update. Both hand out the same values, so every
+// step does the same arithmetic on either path.
+struct ComponentParticles {
+  using Handle = XPBDParticleComponent *;
+  static constexpr bool Packed = false;
 
-    // 4. Update velocities from position changes
-    UpdateVelocities(scene, dt);
+  entt::storage<XPBDParticleComponent> &Storage;
 
-    // 5. Apply friction
-    ApplyFriction(scene, dt);
+  size_t Count() const { return Storage.size(); }
+  Handle At(size_t index) const { return &Storage.get(Storage.data()[index]); }
+  Handle Find(entt::entity entity) const {
+    return Storage.contains(entity) ? &Storage.get(entity) : nullptr;
   }
+  static bool IsValid(Handle particle) { return particle != nullptr; }
 
-  // 6. Update transform components from particle positions
-  UpdateTransforms(scene);
-
-  // 7. Update sleeping state
-  if (EnableSleeping) {
-    UpdateSleeping(scene, deltaTime);
+  vec3 &Position(Handle particle) const { return particle->Position; }
+  vec3 &PreviousPosition(Handle particle) const {
+    return particle->PreviousPosition;
+  }
+  vec3 &Velocity(Handle particle) const { return particle->Velocity; }
+  vec3 &ExternalForce(Handle particle) const {
+    return particle->ExternalForce;
+  }
+  float InverseMass(Handle particle) const { return particle->InverseMass; }
+  float Mass(Handle particle) const { return particle->GetMass(); }
+  bool IsStatic(Handle particle) const { return particle->IsStatic(); }
+  bool IsSleeping(Handle particle) const { return particle->IsSleeping; }
+};
+
+struct StoreParticles {
+  using Handle = uint32_t;
+  static constexpr bool Packed = true;
+
+  XPBDParticleStore &Store;
+
+  size_t Count() const { return Store.Size(); }
+  Handle At(size_t index) const { return static_cast<Handle>(index); }
+  Handle Find(entt::entity entity) const { return Store.IndexOf(entity); }
+  static bool IsValid(Handle particle) {
+    return particle != XPBDParticleStore::NoIndex;
   }
 
-  // Clear temporary contact constraints
-  m_ContactConstraints.clear();
-}
-
-void XPBDSolver::OnRender(Scene *scene) {
-  // Debug rendering handled by PhysicsDebugRenderer
-}
-
-void XPBDSolver::OnShutdown(Scene *scene) { m_ContactConstraints.clear(); }
-
-void XPBDSolver::PredictPositions(Scene *scene, float dt) {
-  auto view = scene->Registry().view<XPBDParticleComponent>();
-
-  m_Stats.ActiveParticles = 0;
-  m_Stats.SleepingParticles = 0;
-
-  for (auto entity : view) {
-    auto &particle = view.get<XPBDParticleComponent>(entity);
-
-    if (particle.IsSleeping) {
-      m_Stats.SleepingParticles++;
-      continue;
-    }
-
-    m_Stats.ActiveParticles++;
-
-    if (particle.IsStatic()) {
-      continue;
+  vec3 &Position(Handle particle) const { return Store.Positions[particle]; }
+  vec3 &PreviousPosition(Handle particle) const {
+    return Store.PreviousPositions[particle];
+  }
+  vec3 &Velocity(Handle particle) const { return Store.Velocities[particle]; }
+  vec3 &ExternalForce(Handle particle) const {
+    return Store.ExternalForces[particle];
+  }
+  float InverseMass(Handle particle) const {
+    return Store.InverseMasses[particle];
+  }
+  float Mass(Handle particle) const {
+    // As XPBDParticleComponent::GetMass
+    const float inverseMass = Store.InverseMasses[particle];
+    return inverseMass > 0.0f ? 1.0f / inverseMass : 0.0f;
+  }
+  bool IsStatic(Handle particle) const {
+    return Store.InverseMasses[particle] == 0.0f;
+  }
+  bool IsSleeping(Handle particle) const {
+    return Store.Sleeping[particle] != 0;
+  }
+};
+
+// Call fn(entity) for every particle a constraint moves
+template <typename T, typename Fn>
+void ForEachConstraintParticle(const T &constraint, Fn &&fn) {
+  if constexpr (std::is_same_v<T, ShapeMatchingConstraint>) {
+    for (entt::entity particle : constraint.Particles) {
+      fn(particle);
     }
-
-    // Store previous position for velocity calculation
-    particle.PreviousPosition = particle.Position;
-
-    // Apply gravity
-    particle.ExternalForce += Gravity * particle.GetMass();
-
-    // Semi-implicit Euler: v += (F/m) * dt
-    vec3 acceleration = particle.ExternalForce * particle.InverseMass;
-    particle.Velocity += acceleration * dt;
-
-    // Predict position: x_new = x + v * dt
-    particle.Position += particle.Velocity * dt;
-
-    // Clear external forces
-    particle.ExternalForce = vec3(0.0f);
+  } else if constexpr (std::is_same_v<T, BendingConstraint> ||
+                       std::is_same_v<T, VolumeConstraint>) {
+    fn(constraint.Particle0);
+    fn(constraint.Particle1);
+    fn(constraint.Particle2);
+    fn(constraint.Particle3);
+  } else {
+    fn(constraint.ParticleA);
+    fn(constraint.ParticleB);
   }
 }
 
-void XPBDSolver::GenerateCollisionConstraints(Scene *scene) {
-  // Broad phase: find potential collision pairs
-  std::vector<CollisionPair> pairs;
-  BroadPhaseCollision(scene, pairs);
-
-  // Narrow phase: generate contact constraints
-  for (const auto &pair : pairs) {
-    ContactConstraint contact;
-    if (NarrowPhaseCollision(scene, pair, contact)) {
-      m_ContactConstraints.push_back(contact);
-    }
+// The k-th particle of a constraint, in ForEachConstraintParticle order
+template <typename T>
+entt::entity ConstraintParticle(const T &constraint, size_t k) {
+  if constexpr (std::is_same_v<T, ShapeMatchingConstraint>) {
+    return constraint.Particles[k];
+  } else if constexpr (std::is_same_v<T, BendingConstraint> ||
+                       std::is_same_v<T, VolumeConstraint>) {
+    const entt::entity particles[4] = {constraint.Particle0,
+                                       constraint.Particle1,
+                                       constraint.Particle2,
+                                       constraint.Particle3};
+    return particles[k];
+  } else {
+    return k == 0 ? constraint.ParticleA : constraint.ParticleB;
   }
-
-  m_Stats.ContactConstraints = static_cast<int>(m_ContactConstraints.size());
 }
 
-void XPBDSolver::SolveConstraints(Scene *scene, float dt) {
-  auto constraintView = scene->Registry().view<XPBDConstraintComponent>();
-
-  m_Stats.ActiveConstraints =
-      static_cast<int>(constraintView.size()) + m_Stats.ContactConstraints;
-
-  // Gauss-Seidel iterations
-  for (int iteration = 0; iteration < SolverIterations; ++iteration) {
-    // Solve persistent constraints
-    for (auto entity : constraintView) {
-      auto &constraintComp =
-          constraintView.get<XPBDConstraintComponent>(entity);
-
-      if (!constraintComp.GetBase()->Active)
-        continue;
-
-      // Dispatch to appropriate solver based on constraint type
-      std::visit(
-          [&](auto &constraint) {
-            using T = std::decay_t<decltype(constraint)>;
-            if constexpr (std::is_same_v<T, DistanceConstraint>) {
-              SolveDistanceConstraint(scene, constraint, dt);
-            } else if constexpr (std::is_same_v<T, ContactConstraint>) {
-              SolveContactConstraint(scene, constraint, dt);
-            } else if constexpr (std::is_same_v<T, BendingConstraint>) {
-              SolveBendingConstraint(scene, constraint, dt);
-            } else if constexpr (std::is_same_v<T, VolumeConstraint>) {
-              SolveVolumeConstraint(scene, constraint, dt);
-            } else if constexpr (std::is_same_v<T, ShapeMatchingConstraint>) {
-              SolveShapeMatchingConstraint(scene, constraint, dt);
-            } else if constexpr (std::is_same_v<T, BallSocketConstraint>) {
-              SolveBallSocketConstraint(scene, constraint, dt);
-            } else if constexpr (std::is_same_v<T, HingeConstraint>) {
-              SolveHingeConstraint(scene, constraint, dt);
-            } else if constexpr (std::is_same_v<T, SliderConstraint>) {
-              SolveSliderConstraint(scene, constraint, dt);
-            }
-          },
-          constraintComp.Constraint);
-    }
-
-    // Solve contact constraints
-    for (auto &contact : m_ContactConstraints) {
-      SolveContactConstraint(scene, contact, dt);
-    }
+// ends(k) gives the handle of a constraint's k-th particle: looked up by
+// entity on the component path, read from its resolved indices on the store
+// path
+template <typename Particles, typename T>
+auto ConstraintEnds(const Particles &particles, const T &constraint,
+                    const uint32_t *resolved) {
+  if constexpr (Particles::Packed) {
+    return [resolved](size_t k) { return resolved[k]; };
+  } else {
+    return [&particles, &constraint](size_t k) {
+      return particles.Find(ConstraintParticle(constraint, k));
+    };
   }
 }
 
-void XPBDSolver::SolveDistanceConstraint(Scene *scene,
-                                         DistanceConstraint &constraint,
-                                         float dt) {
-  auto &registry = scene->Registry();
+// Persistent constraint kernels. Compliant = false is the rigid case,
+// compliance zero: alpha drops out of every update.
+template <bool Compliant, typename Particles, typename Ends>
+void SolveConstraint(const Particles &particles, const Ends &ends,
+                     DistanceConstraint &constraint, float dt,
+                     bool warmStarting) {
+  const auto p1 = ends(0);
+  const auto p2 = ends(1);
 
-  auto *p1 = registry.try_get<XPBDParticleComponent>(constraint.ParticleA);
-  auto *p2 = registry.try_get<XPBDParticleComponent>(constraint.ParticleB);
-
-  if (!p1 || !p2)
+  if (!particles.IsValid(p1) || !particles.IsValid(p2))
     return;
-  if (p1->IsSleeping && p2->IsSleeping)
+  if (particles.IsSleeping(p1) && particles.IsSleeping(p2))
     return;
 
   // Compute constraint value: C = |p1 - p2| - rest_length
-  vec3 delta = p1->Position - p2->Position;
+  vec3 delta = particles.Position(p1) - particles.Position(p2);
   float currentLength = Math::Length(delta);
 
   if (currentLength < 1e-6f)
@@ -207,21 +169,25 @@ void XPBDSolver::SolveDistanceConstraint(Scene *scene,
   vec3 grad = delta / currentLength;
 
   // Compute generalized inverse mass
-  float w1 = p1->InverseMass;
-  float w2 = p2->InverseMass;
+  float w1 = particles.InverseMass(p1);
+  float w2 = particles.InverseMass(p2);
   float w = w1 + w2;
 
   if (w < 1e-6f)
     return; // Both static
 
-  // XPBD: alpha = compliance / dt^2
-  float alpha = constraint.Compliance / (dt * dt);
-
   // Compute delta lambda
-  float deltaLambda = (-C - alpha * constraint.Lambda) / (w + alpha);
+  float deltaLambda;
+  if constexpr (Compliant) {
+    // XPBD: alpha = compliance / dt^2
+    float alpha = constraint.Compliance / (dt * dt);
+    deltaLambda = (-C - alpha * constraint.Lambda) / (w + alpha);
+  } else {
+    deltaLambda = -C / w;
+  }
 
   // Warm starting: use previous lambda
-  if (!EnableWarmStarting) {
+  if (!warmStarting) {
     constraint.Lambda = 0.0f;
   }
 
@@ -231,42 +197,40 @@ void XPBDSolver::SolveDistanceConstraint(Scene *scene,
   // Apply position corrections
   vec3 correction = grad * deltaLambda;
   if (w1 > 0.0f)
-    p1->Position += correction * w1;
+    particles.Position(p1) += correction * w1;
   if (w2 > 0.0f)
-    p2->Position -= correction * w2;
+    particles.Position(p2) -= correction * w2;
 }
 
-void XPBDSolver::SolveContactConstraint(Scene *scene,
-                                        ContactConstraint &constraint,
-                                        float dt) {
-  auto &registry = scene->Registry();
-
-  auto *p1 = registry.try_get<XPBDParticleComponent>(constraint.ParticleA);
-  auto *p2 = registry.try_get<XPBDParticleComponent>(constraint.ParticleB);
-
-  if (!p1 || !p2)
-    return;
-  if (p1->IsSleeping && p2->IsSleeping)
-    return;
+// Updates the contact's lambda; positions move by +correction * w1 and
+// -correction * w2. Returns false when nothing is to be applied.
+template <typename Particles>
+bool ComputeContactCorrection(const Particles &particles,
+                              typename Particles::Handle p1,
+                              typename Particles::Handle p2,
+                              ContactConstraint &constraint, float dt,
+                              vec3 &correction) {
+  if (particles.IsSleeping(p1) && particles.IsSleeping(p2))
+    return false;
 
   // Compute constraint value: C = dot(p1 - p2, normal) - penetration
-  vec3 delta = p1->Position - p2->Position;
+  vec3 delta = particles.Position(p1) - particles.Position(p2);
   float C = Math::Dot(delta, constraint.Normal) - constraint.Penetration;
 
   // Only enforce if penetrating
   if (C >= 0.0f)
-    return;
+    return false;
 
   // Gradient is the normal
   vec3 grad = constraint.Normal;
 
   // Compute generalized inverse mass
-  float w1 = p1->InverseMass;
-  float w2 = p2->InverseMass;
+  float w1 = particles.InverseMass(p1);
+  float w2 = particles.InverseMass(p2);
   float w = w1 + w2;
 
   if (w < 1e-6f)
-    return;
+    return false;
 
   // Contact constraints are typically rigid (zero compliance)
   float alpha = constraint.Compliance / (dt * dt);
@@ -279,31 +243,46 @@ void XPBDSolver::SolveContactConstraint(Scene *scene,
   deltaLambda = newLambda - constraint.Lambda;
   constraint.Lambda = newLambda;
 
-  // Apply position corrections
-  vec3 correction = grad * deltaLambda;
-  if (w1 > 0.0f)
-    p1->Position += correction * w1;
-  if (w2 > 0.0f)
-    p2->Position -= correction * w2;
+  correction = grad * deltaLambda;
+  return true;
 }
 
-void XPBDSolver::SolveBendingConstraint(Scene *scene,
-                                        BendingConstraint &constraint,
-                                        float dt) {
-  auto &registry = scene->Registry();
+template <typename Particles, typename Ends>
+void SolveContact(const Particles &particles, const Ends &ends,
+                  ContactConstraint &constraint, float dt) {
+  const auto p1 = ends(0);
+  const auto p2 = ends(1);
+
+  if (!particles.IsValid(p1) || !particles.IsValid(p2))
+    return;
 
-  auto *p0 = registry.try_get<XPBDParticleComponent>(constraint.Particle0);
-  auto *p1 = registry.try_get<XPBDParticleComponent>(constraint.Particle1);
-  auto *p2 = registry.try_get<XPBDParticleComponent>(constraint.Particle2);
-  auto *p3 = registry.try_get<XPBDParticleComponent>(constraint.Particle3);
+  vec3 correction;
+  if (!ComputeContactCorrection(particles, p1, p2, constraint, dt, correction))
+    return;
+
+  // Apply position corrections
+  if (particles.InverseMass(p1) > 0.0f)
+    particles.Position(p1) += correction * particles.InverseMass(p1);
+  if (particles.InverseMass(p2) > 0.0f)
+    particles.Position(p2) -= correction * particles.InverseMass(p2);
+}
+
+template <bool Compliant, typename Particles, typename Ends>
+void SolveConstraint(const Particles &particles, const Ends &ends,
+                     BendingConstraint &constraint, float dt, bool) {
+  const auto p0 = ends(0);
+  const auto p1 = ends(1);
+  const auto p2 = ends(2);
+  const auto p3 = ends(3);
 
-  if (!p0 || !p1 || !p2 || !p3)
+  if (!particles.IsValid(p0) || !particles.IsValid(p1) ||
+      !particles.IsValid(p2) || !particles.IsValid(p3))
     return;
 
   // Compute normals of the two triangles
-  vec3 e0 = p1->Position - p0->Position;
-  vec3 e1 = p2->Position - p0->Position;
-  vec3 e2 = p3->Position - p0->Position;
+  vec3 e0 = particles.Position(p1) - particles.Position(p0);
+  vec3 e1 = particles.Position(p2) - particles.Position(p0);
+  vec3 e2 = particles.Position(p3) - particles.Position(p0);
 
   vec3 n1 = Math::Cross(e0, e1);
   vec3 n2 = Math::Cross(e0, e2);
@@ -326,44 +305,49 @@ void XPBDSolver::SolveBendingConstraint(Scene *scene,
 
   // Simplified gradient approximation (full derivation is complex)
   // For small angles, we can use a linear approximation
-  float alpha = constraint.Compliance / (dt * dt);
-  float w =
-      p0->InverseMass + p1->InverseMass + p2->InverseMass + p3->InverseMass;
+  float w = particles.InverseMass(p0) + particles.InverseMass(p1) +
+            particles.InverseMass(p2) + particles.InverseMass(p3);
 
   if (w < 1e-6f)
     return;
 
-  float deltaLambda = -C / (w + alpha);
+  float deltaLambda;
+  if constexpr (Compliant) {
+    float alpha = constraint.Compliance / (dt * dt);
+    deltaLambda = -C / (w + alpha);
+  } else {
+    deltaLambda = -C / w;
+  }
   constraint.Lambda += deltaLambda;
 
   // Apply corrections (simplified)
   vec3 correction = Math::Cross(n1, n2) * deltaLambda * 0.25f;
-  if (p0->InverseMass > 0.0f)
-    p0->Position += correction * p0->InverseMass;
-  if (p1->InverseMass > 0.0f)
-    p1->Position += correction * p1->InverseMass;
-  if (p2->InverseMass > 0.0f)
-    p2->Position -= correction * p2->InverseMass;
-  if (p3->InverseMass > 0.0f)
-    p3->Position -= correction * p3->InverseMass;
-}
-
-void XPBDSolver::SolveVolumeConstraint(Scene *scene,
-                                       VolumeConstraint &constraint, float dt) {
-  auto &registry = scene->Registry();
+  if (particles.InverseMass(p0) > 0.0f)
+    particles.Position(p0) += correction * particles.InverseMass(p0);
+  if (particles.InverseMass(p1) > 0.0f)
+    particles.Position(p1) += correction * particles.InverseMass(p1);
+  if (particles.InverseMass(p2) > 0.0f)
+    particles.Position(p2) -= correction * particles.InverseMass(p2);
+  if (particles.InverseMass(p3) > 0.0f)
+    particles.Position(p3) -= correction * particles.InverseMass(p3);
+}
 
-  auto *p0 = registry.try_get<XPBDParticleComponent>(constraint.Particle0);
-  auto *p1 = registry.try_get<XPBDParticleComponent>(constraint.Particle1);
-  auto *p2 = registry.try_get<XPBDParticleComponent>(constraint.Particle2);
-  auto *p3 = registry.try_get<XPBDParticleComponent>(constraint.Particle3);
+template <bool Compliant, typename Particles, typename Ends>
+void SolveConstraint(const Particles &particles, const Ends &ends,
+                     VolumeConstraint &constraint, float dt, bool) {
+  const auto p0 = ends(0);
+  const auto p1 = ends(1);
+  const auto p2 = ends(2);
+  const auto p3 = ends(3);
 
-  if (!p0 || !p1 || !p2 || !p3)
+  if (!particles.IsValid(p0) || !particles.IsValid(p1) ||
+      !particles.IsValid(p2) || !particles.IsValid(p3))
     return;
 
   // Compute current volume: V = 1/6 * dot(p1-p0, cross(p2-p0, p3-p0))
-  vec3 e1 = p1->Position - p0->Position;
-  vec3 e2 = p2->Position - p0->Position;
-  vec3 e3 = p3->Position - p0->Position;
+  vec3 e1 = particles.Position(p1) - particles.Position(p0);
+  vec3 e2 = particles.Position(p2) - particles.Position(p0);
+  vec3 e3 = particles.Position(p3) - particles.Position(p0);
 
   float currentVolume = Math::Dot(e1, Math::Cross(e2, e3)) / 6.0f;
 
@@ -377,36 +361,40 @@ void XPBDSolver::SolveVolumeConstraint(Scene *scene,
   vec3 grad3 = Math::Cross(e1, e2) / 6.0f;
 
   // Compute generalized inverse mass
-  float w = p0->InverseMass * Math::LengthSq(grad0) +
-            p1->InverseMass * Math::LengthSq(grad1) +
-            p2->InverseMass * Math::LengthSq(grad2) +
-            p3->InverseMass * Math::LengthSq(grad3);
+  float w = particles.InverseMass(p0) * Math::LengthSq(grad0) +
+            particles.InverseMass(p1) * Math::LengthSq(grad1) +
+            particles.InverseMass(p2) * Math::LengthSq(grad2) +
+            particles.InverseMass(p3) * Math::LengthSq(grad3);
 
   if (w < 1e-6f)
     return;
 
-  float alpha = constraint.Compliance / (dt * dt);
-  float deltaLambda = (-C - alpha * constraint.Lambda) / (w + alpha);
+  float deltaLambda;
+  if constexpr (Compliant) {
+    float alpha = constraint.Compliance / (dt * dt);
+    deltaLambda = (-C - alpha * constraint.Lambda) / (w + alpha);
+  } else {
+    deltaLambda = -C / w;
+  }
   constraint.Lambda += deltaLambda;
 
   // Apply corrections
-  if (p0->InverseMass > 0.0f)
-    p0->Position += grad0 * deltaLambda * p0->InverseMass;
-  if (p1->InverseMass > 0.0f)
-    p1->Position += grad1 * deltaLambda * p1->InverseMass;
-  if (p2->InverseMass > 0.0f)
-    p2->Position += grad2 * deltaLambda * p2->InverseMass;
-  if (p3->InverseMass > 0.0f)
-    p3->Position += grad3 * deltaLambda * p3->InverseMass;
-}
-
-void XPBDSolver::SolveShapeMatchingConstraint(
-    Scene *scene, ShapeMatchingConstraint &constraint, float dt) {
+  if (particles.InverseMass(p0) > 0.0f)
+    particles.Position(p0) += grad0 * deltaLambda * particles.InverseMass(p0);
+  if (particles.InverseMass(p1) > 0.0f)
+    particles.Position(p1) += grad1 * deltaLambda * particles.InverseMass(p1);
+  if (particles.InverseMass(p2) > 0.0f)
+    particles.Position(p2) += grad2 * deltaLambda * particles.InverseMass(p2);
+  if (particles.InverseMass(p3) > 0.0f)
+    particles.Position(p3) += grad3 * deltaLambda * particles.InverseMass(p3);
+}
+
+template <bool Compliant, typename Particles, typename Ends>
+void SolveConstraint(const Particles &particles, const Ends &ends,
+                     ShapeMatchingConstraint &constraint, float dt, bool) {
   // Shape matching is more complex and requires computing optimal rotation
   // This is a simplified version
 
-  auto &registry = scene->Registry();
-
   if (constraint.Particles.empty())
     return;
 
@@ -414,12 +402,12 @@ void XPBDSolver::SolveShapeMatchingConstraint(
   vec3 currentCOM(0.0f);
   float totalMass = 0.0f;
 
-  for (auto entity : constraint.Particles) {
-    auto *p = registry.try_get<XPBDParticleComponent>(entity);
-    if (!p)
+  for (size_t k = 0; k < constraint.Particles.size(); ++k) {
+    const auto p = ends(k);
+    if (!particles.IsValid(p))
       continue;
-    float mass = p->GetMass();
-    currentCOM += p->Position * mass;
+    float mass = particles.Mass(p);
+    currentCOM += particles.Position(p) * mass;
     totalMass += mass;
   }
 
@@ -429,150 +417,773 @@ void XPBDSolver::SolveShapeMatchingConstraint(
 
   // Compute goal positions (simplified: no rotation matching)
   size_t i = 0;
-  for (auto entity : constraint.Particles) {
-    auto *p = registry.try_get<XPBDParticleComponent>(entity);
-    if (!p || i >= constraint.RestPositions.size())
+  for (size_t k = 0; k < constraint.Particles.size(); ++k) {
+    const auto p = ends(k);
+    if (!particles.IsValid(p) || i >= constraint.RestPositions.size())
       continue;
 
     vec3 goalPos = currentCOM + constraint.RestPositions[i];
-    vec3 delta = goalPos - p->Position;
+    vec3 delta = goalPos - particles.Position(p);
 
-    // Apply correction with compliance
-    float alpha = constraint.Compliance / (dt * dt);
-    float w = p->InverseMass;
+    float w = particles.InverseMass(p);
     if (w < 1e-6f)
       continue;
 
-    float deltaLambda = Math::Length(delta) / (w + alpha);
+    // Apply correction with compliance
+    float deltaLambda;
+    if constexpr (Compliant) {
+      float alpha = constraint.Compliance / (dt * dt);
+      deltaLambda = Math::Length(delta) / (w + alpha);
+    } else {
+      deltaLambda = Math::Length(delta) / w;
+    }
     vec3 correction = Math::Normalize(delta) * deltaLambda;
 
-    p->Position += correction * w;
+    particles.Position(p) += correction * w;
     i++;
   }
 }
 
-void XPBDSolver::SolveBallSocketConstraint(Scene *scene,
-                                           BallSocketConstraint &constraint,
-                                           float dt) {
-  auto &registry = scene->Registry();
+template <bool Compliant, typename Particles, typename Ends>
+void SolveConstraint(const Particles &particles, const Ends &ends,
+                     BallSocketConstraint &constraint, float dt, bool) {
+  const auto p1 = ends(0);
+  const auto p2 = ends(1);
 
-  auto *p1 = registry.try_get<XPBDParticleComponent>(constraint.ParticleA);
-  auto *p2 = registry.try_get<XPBDParticleComponent>(constraint.ParticleB);
-
-  if (!p1 || !p2)
+  if (!particles.IsValid(p1) || !particles.IsValid(p2))
     return;
 
   // Constraint: C = p1 - p2 (3D constraint)
-  vec3 C = p1->Position - p2->Position;
+  vec3 C = particles.Position(p1) - particles.Position(p2);
 
-  float w1 = p1->InverseMass;
-  float w2 = p2->InverseMass;
+  float w1 = particles.InverseMass(p1);
+  float w2 = particles.InverseMass(p2);
   float w = w1 + w2;
 
   if (w < 1e-6f)
     return;
 
-  float alpha = constraint.Compliance / (dt * dt);
+  float denominator = w;
+  if constexpr (Compliant) {
+    denominator += constraint.Compliance / (dt * dt);
+  }
 
   // Solve for each axis independently
   for (int axis = 0; axis < 3; ++axis) {
     float c = C[axis];
-    float deltaLambda = -c / (w + alpha);
+    float deltaLambda = -c / denominator;
 
     vec3 correction(0.0f);
     correction[axis] = deltaLambda;
 
     if (w1 > 0.0f)
-      p1->Position += correction * w1;
+      particles.Position(p1) += correction * w1;
     if (w2 > 0.0f)
-      p2->Position -= correction * w2;
+      particles.Position(p2) -= correction * w2;
   }
 }
 
-void XPBDSolver::SolveHingeConstraint(Scene *scene, HingeConstraint &constraint,
-                                      float dt) {
+template <bool Compliant, typename Particles, typename Ends>
+void SolveConstraint(const Particles &particles, const Ends &ends,
+                     HingeConstraint &constraint, float dt, bool) {
   // Hinge constraint is complex, requires position + orientation constraints
   // Simplified implementation: just constrain positions like ball-socket
-  auto &registry = scene->Registry();
-
-  auto *p1 = registry.try_get<XPBDParticleComponent>(constraint.ParticleA);
-  auto *p2 = registry.try_get<XPBDParticleComponent>(constraint.ParticleB);
+  const auto p1 = ends(0);
+  const auto p2 = ends(1);
 
-  if (!p1 || !p2)
+  if (!particles.IsValid(p1) || !particles.IsValid(p2))
     return;
 
-  vec3 C = p1->Position - p2->Position;
-  float w = p1->InverseMass + p2->InverseMass;
+  vec3 C = particles.Position(p1) - particles.Position(p2);
+  float w = particles.InverseMass(p1) + particles.InverseMass(p2);
   if (w < 1e-6f)
     return;
 
-  float alpha = constraint.Compliance / (dt * dt);
-  vec3 correction = C / (w + alpha);
+  float denominator = w;
+  if constexpr (Compliant) {
+    denominator += constraint.Compliance / (dt * dt);
+  }
+  vec3 correction = C / denominator;
 
-  if (p1->InverseMass > 0.0f)
-    p1->Position -= correction * p1->InverseMass;
-  if (p2->InverseMass > 0.0f)
-    p2->Position += correction * p2->InverseMass;
+  if (particles.InverseMass(p1) > 0.0f)
+    particles.Position(p1) -= correction * particles.InverseMass(p1);
+  if (particles.InverseMass(p2) > 0.0f)
+    particles.Position(p2) += correction * particles.InverseMass(p2);
 }
 
-void XPBDSolver::SolveSliderConstraint(Scene *scene,
-                                       SliderConstraint &constraint, float dt) {
+template <bool Compliant, typename Particles, typename Ends>
+void SolveConstraint(const Particles &particles, const Ends &ends,
+                     SliderConstraint &constraint, float dt, bool) {
   // Slider constraint: constrain motion perpendicular to slide axis
-  auto &registry = scene->Registry();
-
-  auto *p1 = registry.try_get<XPBDParticleComponent>(constraint.ParticleA);
-  auto *p2 = registry.try_get<XPBDParticleComponent>(constraint.ParticleB);
+  const auto p1 = ends(0);
+  const auto p2 = ends(1);
 
-  if (!p1 || !p2)
+  if (!particles.IsValid(p1) || !particles.IsValid(p2))
     return;
 
-  vec3 delta = p1->Position - p2->Position;
+  vec3 delta = particles.Position(p1) - particles.Position(p2);
 
   // Project delta onto plane perpendicular to slide axis
   vec3 slideAxis = Math::Normalize(constraint.SlideAxis);
   float projection = Math::Dot(delta, slideAxis);
   vec3 perpendicular = delta - slideAxis * projection;
 
-  float w = p1->InverseMass + p2->InverseMass;
+  float w = particles.InverseMass(p1) + particles.InverseMass(p2);
   if (w < 1e-6f)
     return;
 
-  float alpha = constraint.Compliance / (dt * dt);
-  vec3 correction = perpendicular / (w + alpha);
+  float denominator = w;
+  if constexpr (Compliant) {
+    denominator += constraint.Compliance / (dt * dt);
+  }
+  vec3 correction = perpendicular / denominator;
 
-  if (p1->InverseMass > 0.0f)
-    p1->Position -= correction * p1->InverseMass;
-  if (p2->InverseMass > 0.0f)
-    p2->Position += correction * p2->InverseMass;
+  if (particles.InverseMass(p1) > 0.0f)
+    particles.Position(p1) -= correction * particles.InverseMass(p1);
+  if (particles.InverseMass(p2) > 0.0f)
+    particles.Position(p2) += correction * particles.InverseMass(p2);
 }
 
-void XPBDSolver::UpdateVelocities(Scene *scene, float dt) {
-  auto view = scene->Registry().view<XPBDParticleComponent>();
+// Greedy colouring state: one bit per colour already used at each particle
+class ColorAssigner {
+public:
+  ColorAssigner(const entt::storage<XPBDParticleComponent> &particles,
+                int maxColors)
+      : m_Particles(particles),
+        m_Used(particles.size(), 0, Core::GetScratchResource()),
+        m_Dynamic(Core::GetScratchResource()),
+        m_Allowed(maxColors >= 64 ? ~0ull : (1ull << maxColors) - 1) {}
+
+  // Forget every colour, to colour a new set of constraints
+  void Reset() { std::fill(m_Used.begin(), m_Used.end(), 0); }
+
+  void Begin() {
+    m_Dynamic.clear();
+    m_Taken = 0;
+  }
 
-  for (auto entity : view) {
-    auto &particle = view.get<XPBDParticleComponent>(entity);
+  // Static particles are never written by the solver, so they may be shared
+  void Add(entt::entity entity) {
+    if (!m_Particles.contains(entity) ||
+        m_Particles.get(entity).IsStatic())
+      return;
+
+    const size_t index = m_Particles.index(entity);
+    m_Dynamic.push_back(static_cast<uint32_t>(index));
+    m_Taken |= m_Used[index];
+  }
+
+  // Lowest colour free at every added particle, or -1 if none is left
+  int Assign() {
+    const uint64_t free = ~m_Taken & m_Allowed;
+    if (free == 0)
+      return -1;
+
+    const int color = std::countr_zero(free);
+    for (uint32_t index : m_Dynamic) {
+      m_Used[index] |= 1ull << color;
+    }
+    return color;
+  }
+
+private:
+  const entt::storage<XPBDParticleComponent> &m_Particles;
+  std::pmr::vector<uint64_t> m_Used;
+  std::pmr::vector<uint32_t> m_Dynamic;
+  uint64_t m_Allowed;
+  uint64_t m_Taken = 0;
+};
+
+// Bodies wider than this many broad phase cells skip the grid
+constexpr float OversizedCellSpan = 4.0f;
 
-    if (particle.IsSleeping || particle.IsStatic())
+void HashCombine(uint64_t &hash, uint64_t value) {
+  hash ^= value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+}
+
+} // namespace
+
+XPBDSolver::XPBDSolver() {}
+
+XPBDSolver::~XPBDSolver() {}
+
+void XPBDSolver::OnInit(Scene *scene) {
+  // Create the constraint store here, on the main thread
+  if (scene) {
+    XPBDConstraintStore::Get(scene->Registry());
+  }
+
+  YAMEN_CORE_INFO("XPBD Solver initialized");
+  YAMEN_CORE_INFO("  SubSteps: {}", SubSteps);
+  YAMEN_CORE_INFO("  Solver Iterations: {}", SolverIterations);
+}
+
+void XPBDSolver::OnUpdate(Scene *scene, float deltaTime) {
+  if (!scene)
+    return;
+
+  Core::ScopedMemoryTag memoryTag(Core::MemoryTag::Physics);
+  auto startTime = std::chrono::high_resolution_clock::now();
+
+  // Reset statistics
+  m_Stats = Stats();
+
+  // Contacts only live for this update; keep them in frame memory if available
+  Core::ResetForScratch(m_ContactConstraints);
+  Core::ResetForScratch(m_ContactParticles);
+
+  // Rigid constraints first in each type, for the rigid kernels
+  XPBDConstraintStore::Get(scene->Registry()).PartitionByCompliance();
+
+  if (ParallelSolve) {
+    UpdateConstraintColoring(scene);
+  }
+
+  // Pack the particles once for every substep
+  auto &particleStorage = scene->Registry().storage<XPBDParticleComponent>();
+  if (UseParticleStore) {
+    m_ParticleStore.Gather(particleStorage);
+    ResolveConstraintParticles(scene);
+  }
+
+  // Substep the simulation for stability
+  float dt = deltaTime / static_cast<float>(SubSteps);
+
+  for (int substep = 0; substep < SubSteps; ++substep) {
+    if (UseParticleStore) {
+      Substep(scene, StoreParticles{m_ParticleStore}, dt);
+    } else {
+      Substep(scene, ComponentParticles{particleStorage}, dt);
+    }
+  }
+
+  if (UseParticleStore) {
+    m_ParticleStore.Scatter(particleStorage);
+  }
+
+  // 6. Update transform components from particle positions
+  UpdateTransforms(scene);
+
+  // 7. Update sleeping state
+  if (EnableSleeping) {
+    UpdateSleeping(scene, deltaTime);
+  }
+
+  // Clear temporary contact constraints
+  m_ContactConstraints.clear();
+  m_ContactParticles.clear();
+}
+
+void XPBDSolver::OnRender(Scene *scene) {
+  // Debug rendering handled by PhysicsDebugRenderer
+}
+
+void XPBDSolver::OnShutdown(Scene *scene) {
+  m_ContactConstraints.clear();
+  m_ContactParticles.clear();
+}
+
+template <typename Particles>
+void XPBDSolver::Substep(Scene *scene, const Particles &particles, float dt) {
+  // 1. Predict positions using external forces
+  PredictPositions(scene, particles, dt);
+
+  // 2. Generate collision constraints
+  auto collisionStart = std::chrono::high_resolution_clock::now();
+  GenerateCollisionConstraints(scene, particles);
+  auto collisionEnd = std::chrono::high_resolution_clock::now();
+  m_Stats.CollisionTime =
+      std::chrono::duration<float, std::milli>(collisionEnd - collisionStart)
+          .count();
+
+  // 3. Solve all constraints iteratively
+  auto solveStart = std::chrono::high_resolution_clock::now();
+  SolveConstraints(scene, particles, dt);
+  auto solveEnd = std::chrono::high_resolution_clock::now();
+  m_Stats.SolveTime =
+      std::chrono::duration<float, std::milli>(solveEnd - solveStart).count();
+
+  // 4. Update velocities from position changes
+  UpdateVelocities(scene, particles, dt);
+
+  // 5. Apply friction
+  ApplyFriction(particles, dt);
+}
+
+template <typename Particles>
+void XPBDSolver::PredictPositions(Scene *scene, const Particles &particles,
+                                  float dt) {
+  std::atomic<int> activeParticles{0};
+  std::atomic<int> sleepingParticles{0};
+
+  auto predictRange = [&](size_t begin, size_t end) {
+    int active = 0;
+    int sleeping = 0;
+
+    for (size_t i = begin; i < end; ++i) {
+      const auto particle = particles.At(i);
+
+      if (particles.IsSleeping(particle)) {
+        sleeping++;
+        continue;
+      }
+
+      active++;
+
+      if (particles.IsStatic(particle)) {
+        continue;
+      }
+
+      // Store previous position for velocity calculation
+      particles.PreviousPosition(particle) = particles.Position(particle);
+
+      // Apply gravity
+      particles.ExternalForce(particle) += Gravity * particles.Mass(particle);
+
+      // Semi-implicit Euler: v += (F/m) * dt
+      vec3 acceleration =
+          particles.ExternalForce(particle) * particles.InverseMass(particle);
+      particles.Velocity(particle) += acceleration * dt;
+
+      // Predict position: x_new = x + v * dt
+      particles.Position(particle) += particles.Velocity(particle) * dt;
+
+      // Clear external forces
+      particles.ExternalForce(particle) = vec3(0.0f);
+    }
+
+    // One atomic update per chunk rather than per particle
+    activeParticles.fetch_add(active, std::memory_order_relaxed);
+    sleepingParticles.fetch_add(sleeping, std::memory_order_relaxed);
+  };
+
+  if (Core::ThreadPool *pool = scene->GetThreadPool()) {
+    Core::ParallelForChunked(*pool, Core::IndexRange{0, particles.Count()}, 0,
+                             predictRange);
+  } else {
+    predictRange(0, particles.Count());
+  }
+
+  m_Stats.ActiveParticles = activeParticles.load();
+  m_Stats.SleepingParticles = sleepingParticles.load();
+}
+
+template <typename Particles>
+void XPBDSolver::GenerateCollisionConstraints(Scene *scene,
+                                              const Particles &particles) {
+  // Broad phase: find potential collision pairs (released after each substep)
+  Core::StackScope scratch;
+  CollisionPairList pairs(scratch.GetResource());
+  BroadPhaseCollision(scene, particles, pairs);
+
+  // Narrow phase: generate contact constraints
+  for (const auto &pair : pairs) {
+    ContactConstraint contact;
+    if (NarrowPhaseCollision(scene, particles, pair, contact)) {
+      m_ContactConstraints.push_back(contact);
+      if constexpr (Particles::Packed) {
+        m_ContactParticles.push_back(particles.Find(contact.ParticleA));
+        m_ContactParticles.push_back(particles.Find(contact.ParticleB));
+      }
+    }
+  }
+
+  m_Stats.ContactConstraints = static_cast<int>(m_ContactConstraints.size());
+}
+
+void XPBDSolver::ResolveConstraintParticles(Scene *scene) {
+  auto &constraints = XPBDConstraintStore::Get(scene->Registry());
+
+  constraints.ForEachArray([this](const auto &array) {
+    ResolvedParticles &resolved =
+        m_ResolvedParticles[static_cast<size_t>(array.Type)];
+    resolved.Indices.clear();
+    resolved.Offsets.clear();
+
+    for (const auto &constraint : array.Constraints) {
+      resolved.Offsets.push_back(
+          static_cast<uint32_t>(resolved.Indices.size()));
+      ForEachConstraintParticle(constraint, [&](entt::entity p) {
+        resolved.Indices.push_back(m_ParticleStore.IndexOf(p));
+      });
+    }
+    resolved.Offsets.push_back(static_cast<uint32_t>(resolved.Indices.size()));
+  });
+}
+
+template <typename Particles>
+void XPBDSolver::SolveConstraints(Scene *scene, const Particles &particles,
+                                  float dt) {
+  if (ParallelSolve) {
+    SolveConstraintsParallel(scene, particles, dt);
+    return;
+  }
+
+  auto &constraints = XPBDConstraintStore::Get(scene->Registry());
+
+  m_Stats.ActiveConstraints =
+      static_cast<int>(constraints.Size()) + m_Stats.ContactConstraints;
+
+  // Gauss-Seidel iterations
+  for (int iteration = 0; iteration < SolverIterations; ++iteration) {
+    // Solve persistent constraints, one type at a time
+    constraints.ForEachArray([&](auto &array) {
+      SolveConstraintRange<false>(particles, array, 0, array.RigidCount, dt);
+      SolveConstraintRange<true>(particles, array, array.RigidCount,
+                                 array.Size(), dt);
+    });
+
+    // Solve contact constraints
+    for (size_t c = 0; c < m_ContactConstraints.size(); ++c) {
+      SolveContactConstraint(particles, c, dt);
+    }
+  }
+}
+
+template <bool Compliant, typename Particles, typename T>
+void XPBDSolver::SolveConstraintRange(const Particles &particles,
+                                      XPBDConstraintArray<T> &array,
+                                      uint32_t begin, uint32_t end, float dt) {
+  for (uint32_t index = begin; index < end; ++index) {
+    SolvePersistentConstraint<Compliant>(particles, array, index, dt);
+  }
+}
+
+template <bool Compliant, typename Particles, typename T>
+void XPBDSolver::SolvePersistentConstraint(const Particles &particles,
+                                           XPBDConstraintArray<T> &array,
+                                           uint32_t index, float dt) {
+  T &constraint = array.Constraints[index];
+  if (!constraint.Active)
+    return;
+
+  const uint32_t *resolved = nullptr;
+  if constexpr (Particles::Packed) {
+    const ResolvedParticles &particlesOfType =
+        m_ResolvedParticles[static_cast<size_t>(T::Type)];
+    resolved = particlesOfType.Indices.data() + particlesOfType.Offsets[index];
+  }
+
+  SolveConstraint<Compliant>(particles,
+                             ConstraintEnds(particles, constraint, resolved),
+                             constraint, dt, EnableWarmStarting);
+}
+
+template <typename Particles>
+void XPBDSolver::SolveContactConstraint(const Particles &particles,
+                                        size_t contactIndex, float dt) {
+  ContactConstraint &contact = m_ContactConstraints[contactIndex];
+  const uint32_t *resolved =
+      Particles::Packed ? m_ContactParticles.data() + 2 * contactIndex
+                        : nullptr;
+  SolveContact(particles, ConstraintEnds(particles, contact, resolved),
+               contact, dt);
+}
+
+void XPBDSolver::UpdateConstraintColoring(Scene *scene) {
+  auto &registry = scene->Registry();
+  auto &particles = registry.storage<XPBDParticleComponent>();
+  auto &constraints = XPBDConstraintStore::Get(registry);
+
+  // Topology: how many constraints of each type and compliance, in which
+  // order, what they connect and which of those particles are static
+  uint64_t signature = constraints.Size();
+  constraints.ForEachArray([&](const auto &array) {
+    HashCombine(signature, array.Size());
+    HashCombine(signature, array.RigidCount);
+    for (const auto &constraint : array.Constraints) {
+      ForEachConstraintParticle(constraint, [&](entt::entity p) {
+        HashCombine(signature, entt::to_integral(p));
+        HashCombine(signature, particles.contains(p) &&
+                                   particles.get(p).IsStatic());
+      });
+    }
+  });
+
+  if (m_ColoringValid && signature == m_ColoringSignature) {
+    return;
+  }
+  m_ColoringSignature = signature;
+  m_ColoringValid = true;
+
+  m_ColoredConstraints.clear();
+  m_ConstraintBatches.clear();
+
+  ColorAssigner assigner(particles, 64);
+  std::pmr::vector<int> colors(Core::GetScratchResource());
+  std::pmr::vector<uint32_t> uncolored(Core::GetScratchResource());
+
+  // Colour constraints [begin, end) of one array into batches
+  auto colorRange = [&](const auto &array, uint32_t begin, uint32_t end,
+                        bool compliant) {
+    assigner.Reset();
+    colors.clear();
+    uncolored.clear();
+    std::array<uint32_t, 65> counts{};
+
+    for (uint32_t index = begin; index < end; ++index) {
+      assigner.Begin();
+      ForEachConstraintParticle(array.Constraints[index],
+                                [&](entt::entity p) { assigner.Add(p); });
+
+      const int color = assigner.Assign();
+      colors.push_back(color);
+      if (color < 0) {
+        uncolored.push_back(index);
+      } else {
+        ++counts[color + 1];
+      }
+    }
+
+    // Counting sort by colour, keeping array order inside each batch
+    for (int c = 0; c < 64; ++c) {
+      counts[c + 1] += counts[c];
+    }
+
+    const uint32_t base = static_cast<uint32_t>(m_ColoredConstraints.size());
+    m_ColoredConstraints.resize(base + counts[64]);
+    std::array<uint32_t, 65> cursor = counts;
+    for (uint32_t index = begin; index < end; ++index) {
+      const int color = colors[index - begin];
+      if (color >= 0) {
+        m_ColoredConstraints[base + cursor[color]++] = index;
+      }
+    }
+
+    for (int c = 0; c < 64; ++c) {
+      if (counts[c + 1] > counts[c]) {
+        m_ConstraintBatches.push_back({array.Type, compliant, true,
+                                       base + counts[c], base + counts[c + 1]});
+      }
+    }
+
+    if (!uncolored.empty()) {
+      const uint32_t first = static_cast<uint32_t>(m_ColoredConstraints.size());
+      m_ColoredConstraints.insert(m_ColoredConstraints.end(), uncolored.begin(),
+                                  uncolored.end());
+      m_ConstraintBatches.push_back(
+          {array.Type, compliant, false, first,
+           static_cast<uint32_t>(m_ColoredConstraints.size())});
+    }
+  };
+
+  constraints.ForEachArray([&](const auto &array) {
+    colorRange(array, 0, array.RigidCount, false);
+    colorRange(array, array.RigidCount, array.Size(), true);
+  });
+}
+
+template <typename Particles>
+void XPBDSolver::SolveConstraintsParallel(Scene *scene,
+                                          const Particles &particles,
+                                          float dt) {
+  auto &registry = scene->Registry();
+  auto &constraints = XPBDConstraintStore::Get(registry);
+  auto &particleStorage = registry.storage<XPBDParticleComponent>();
+  Core::ThreadPool *pool = scene->GetThreadPool();
+
+  m_Stats.ActiveConstraints =
+      static_cast<int>(constraints.Size()) + m_Stats.ContactConstraints;
+  m_Stats.ConstraintColors = static_cast<int>(std::count_if(
+      m_ConstraintBatches.begin(), m_ConstraintBatches.end(),
+      [](const ConstraintBatch &batch) { return batch.Parallel; }));
+
+  // Colour this substep's contacts; the rest fall back to Jacobi
+  const int maxContactColors = std::clamp(MaxContactColors, 0, 64);
+  std::pmr::vector<uint32_t> contactOrder(Core::GetScratchResource());
+  std::pmr::vector<uint32_t> contactOffsets(maxContactColors + 1, 0,
+                                            Core::GetScratchResource());
+  std::pmr::vector<uint32_t> jacobiContacts(Core::GetScratchResource());
+  {
+    ColorAssigner assigner(particleStorage, maxContactColors);
+    std::pmr::vector<int> colors(Core::GetScratchResource());
+    colors.reserve(m_ContactConstraints.size());
+
+    for (uint32_t c = 0; c < m_ContactConstraints.size(); ++c) {
+      assigner.Begin();
+      assigner.Add(m_ContactConstraints[c].ParticleA);
+      assigner.Add(m_ContactConstraints[c].ParticleB);
+
+      const int color = maxContactColors > 0 ? assigner.Assign() : -1;
+      colors.push_back(color);
+      if (color < 0) {
+        jacobiContacts.push_back(c);
+      } else {
+        ++contactOffsets[color + 1];
+      }
+    }
+
+    for (int c = 0; c < maxContactColors; ++c) {
+      contactOffsets[c + 1] += contactOffsets[c];
+    }
+    contactOrder.resize(contactOffsets[maxContactColors]);
+
+    std::pmr::vector<uint32_t> cursor(contactOffsets.begin(),
+                                      contactOffsets.end(),
+                                      Core::GetScratchResource());
+    for (uint32_t c = 0; c < colors.size(); ++c) {
+      if (colors[c] >= 0) {
+        contactOrder[cursor[colors[c]]++] = c;
+      }
+    }
+  }
+  m_Stats.JacobiContacts = static_cast<int>(jacobiContacts.size());
+
+  // Members of one batch share no dynamic particle, so they run concurrently
+  auto runBatch = [pool](size_t count, auto &&solve) {
+    if (pool) {
+      Core::ParallelFor(*pool, Core::IndexRange{0, count}, 0, solve);
+    } else {
+      for (size_t i = 0; i < count; ++i) {
+        solve(i);
+      }
+    }
+  };
+
+  // One batch of persistent constraints, with the rigid or compliant kernel
+  auto solveBatch = [&](const ConstraintBatch &batch, auto &array,
+                        auto compliant) {
+    const uint32_t *indices = m_ColoredConstraints.data() + batch.Begin;
+    auto solve = [&](size_t i) {
+      SolvePersistentConstraint<decltype(compliant)::value>(particles, array,
+                                                            indices[i], dt);
+    };
+
+    if (batch.Parallel) {
+      runBatch(batch.End - batch.Begin, solve);
+    } else {
+      for (size_t i = 0; i < batch.End - batch.Begin; ++i) {
+        solve(i);
+      }
+    }
+  };
+
+  // Jacobi scratch: corrections per contact, then summed per particle
+  std::pmr::vector<vec3> corrections(jacobiContacts.size(),
+                                     Core::GetScratchResource());
+  std::pmr::vector<uint8_t> applied(jacobiContacts.size(), 0,
+                                    Core::GetScratchResource());
+  std::pmr::vector<vec3> accumulated(
+      jacobiContacts.empty() ? 0 : particles.Count(), vec3(0.0f),
+      Core::GetScratchResource());
+  std::pmr::vector<uint32_t> touchCount(accumulated.size(), 0,
+                                        Core::GetScratchResource());
+  std::pmr::vector<uint32_t> touched(Core::GetScratchResource());
+
+  for (int iteration = 0; iteration < SolverIterations; ++iteration) {
+    for (const ConstraintBatch &batch : m_ConstraintBatches) {
+      constraints.VisitArray(batch.Type, [&](auto &array) {
+        if (batch.Compliant) {
+          solveBatch(batch, array, std::true_type{});
+        } else {
+          solveBatch(batch, array, std::false_type{});
+        }
+      });
+    }
+
+    for (int c = 0; c < maxContactColors; ++c) {
+      const uint32_t offset = contactOffsets[c];
+      runBatch(contactOffsets[c + 1] - offset, [&](size_t i) {
+        SolveContactConstraint(particles, contactOrder[offset + i], dt);
+      });
+    }
+
+    if (jacobiContacts.empty())
       continue;
 
-    // Update velocity from position change: v = (x_new - x_old) / dt
-    particle.Velocity = (particle.Position - particle.PreviousPosition) / dt;
+    // Jacobi: every contact reads the same positions...
+    runBatch(jacobiContacts.size(), [&](size_t i) {
+      const uint32_t c = jacobiContacts[i];
+      ContactConstraint &contact = m_ContactConstraints[c];
+      const auto ends = ConstraintEnds(
+          particles, contact,
+          Particles::Packed ? m_ContactParticles.data() + 2 * c : nullptr);
+      const auto p1 = ends(0);
+      const auto p2 = ends(1);
+      applied[i] = particles.IsValid(p1) && particles.IsValid(p2) &&
+                   ComputeContactCorrection(particles, p1, p2, contact, dt,
+                                            corrections[i]);
+    });
+
+    // ...then each particle moves by the average of its corrections
+    for (size_t i = 0; i < jacobiContacts.size(); ++i) {
+      if (!applied[i])
+        continue;
+
+      const uint32_t c = jacobiContacts[i];
+      const ContactConstraint &contact = m_ContactConstraints[c];
+      const float signs[2] = {1.0f, -1.0f};
+      const entt::entity ends[2] = {contact.ParticleA, contact.ParticleB};
+
+      for (int end = 0; end < 2; ++end) {
+        size_t index;
+        if constexpr (Particles::Packed) {
+          index = m_ContactParticles[2 * c + end];
+        } else {
+          index = particleStorage.index(ends[end]);
+        }
+
+        const float w = particles.InverseMass(particles.At(index));
+        if (w <= 0.0f)
+          continue;
+
+        if (touchCount[index]++ == 0) {
+          touched.push_back(static_cast<uint32_t>(index));
+        }
+        accumulated[index] += corrections[i] * (w * signs[end]);
+      }
+    }
+
+    for (uint32_t index : touched) {
+      particles.Position(particles.At(index)) +=
+          accumulated[index] / static_cast<float>(touchCount[index]);
+      accumulated[index] = vec3(0.0f);
+      touchCount[index] = 0;
+    }
+    touched.clear();
   }
 }
 
-void XPBDSolver::ApplyFriction(Scene *scene, float dt) {
-  // Apply friction to contact constraints
-  for (auto &contact : m_ContactConstraints) {
-    auto &registry = scene->Registry();
+template <typename Particles>
+void XPBDSolver::UpdateVelocities(Scene *scene, const Particles &particles,
+                                  float dt) {
+  auto updateRange = [&particles, dt](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      const auto particle = particles.At(i);
+      if (particles.IsSleeping(particle) || particles.IsStatic(particle))
+        continue;
 
-    auto *p1 = registry.try_get<XPBDParticleComponent>(contact.ParticleA);
-    auto *p2 = registry.try_get<XPBDParticleComponent>(contact.ParticleB);
+      // Update velocity from position change: v = (x_new - x_old) / dt
+      particles.Velocity(particle) = (particles.Position(particle) -
+                                      particles.PreviousPosition(particle)) /
+                                     dt;
+    }
+  };
+
+  if (Core::ThreadPool *pool = scene->GetThreadPool()) {
+    Core::ParallelForChunked(*pool, Core::IndexRange{0, particles.Count()}, 0,
+                             updateRange);
+  } else {
+    updateRange(0, particles.Count());
+  }
+}
 
-    if (!p1 || !p2)
+template <typename Particles>
+void XPBDSolver::ApplyFriction(const Particles &particles, float dt) {
+  // Apply friction to contact constraints
+  for (size_t c = 0; c < m_ContactConstraints.size(); ++c) {
+    auto &contact = m_ContactConstraints[c];
+    const auto ends = ConstraintEnds(
+        particles, contact,
+        Particles::Packed ? m_ContactParticles.data() + 2 * c : nullptr);
+    const auto p1 = ends(0);
+    const auto p2 = ends(1);
+
+    if (!particles.IsValid(p1) || !particles.IsValid(p2))
       continue;
 
     // Compute relative velocity
-    vec3 relVel = p1->Velocity - p2->Velocity;
+    vec3 relVel = particles.Velocity(p1) - particles.Velocity(p2);
 
     // Tangential velocity (perpendicular to normal)
     vec3 tangentVel =
@@ -593,17 +1204,17 @@ void XPBDSolver::ApplyFriction(Scene *scene, float dt) {
 
     vec3 frictionDelta = tangentDir * frictionImpulse;
 
-    float w1 = p1->InverseMass;
-    float w2 = p2->InverseMass;
+    float w1 = particles.InverseMass(p1);
+    float w2 = particles.InverseMass(p2);
     float w = w1 + w2;
 
     if (w < 1e-6f)
       continue;
 
     if (w1 > 0.0f)
-      p1->Velocity -= frictionDelta * (w1 / w);
+      particles.Velocity(p1) -= frictionDelta * (w1 / w);
     if (w2 > 0.0f)
-      p2->Velocity += frictionDelta * (w2 / w);
+      particles.Velocity(p2) += frictionDelta * (w2 / w);
   }
 }
 
@@ -644,11 +1255,18 @@ void XPBDSolver::UpdateSleeping(Scene *scene, float dt) {
   }
 }
 
-void XPBDSolver::BroadPhaseCollision(Scene *scene,
-                                     std::vector<CollisionPair> &pairs) {
-  // Simple O(N^2) broad phase for now
-  // TODO: Implement spatial hashing for better performance
+template <typename Particles>
+void XPBDSolver::BroadPhaseCollision(Scene *scene, const Particles &particles,
+                                     CollisionPairList &pairs) {
+  if (BroadPhase == BroadPhaseMode::AllPairs) {
+    BroadPhaseAllPairs(scene, pairs);
+  } else {
+    BroadPhaseSpatialHash(scene, particles, pairs);
+  }
+  m_Stats.BroadPhasePairs = static_cast<int>(pairs.size());
+}
 
+void XPBDSolver::BroadPhaseAllPairs(Scene *scene, CollisionPairList &pairs) {
   auto view =
       scene->Registry()
           .view<TransformComponent, ColliderComponent, XPBDParticleComponent>();
@@ -672,7 +1290,150 @@ void XPBDSolver::BroadPhaseCollision(Scene *scene,
   }
 }
 
-bool XPBDSolver::NarrowPhaseCollision(Scene *scene, const CollisionPair &pair,
+template <typename Particles>
+void XPBDSolver::BroadPhaseSpatialHash(Scene *scene, const Particles &particles,
+                                       CollisionPairList &pairs) {
+  auto view =
+      scene->Registry()
+          .view<TransformComponent, ColliderComponent, XPBDParticleComponent>();
+
+  struct Body {
+    entt::entity entity;
+    vec3 min;
+    vec3 max;
+    float extent;
+  };
+
+  // Not on the thread stack: the caller's pair list grows on it meanwhile
+  std::pmr::vector<Body> bodies(Core::GetScratchResource());
+  bodies.reserve(view.size_hint());
+
+  // Bounds around the predicted positions
+  for (auto entity : view) {
+    Body body{entity, vec3(0.0f), vec3(0.0f), 0.0f};
+    ComputeBounds(view.get<ColliderComponent>(entity),
+                  particles.Position(particles.Find(entity)), body.min,
+                  body.max);
+
+    vec3 extent = body.max - body.min;
+    body.extent = std::max(extent.x, std::max(extent.y, extent.z));
+    bodies.push_back(body);
+  }
+
+  if (bodies.size() < 2)
+    return;
+
+  // Size cells for a typical body rather than the largest one, so a single
+  // ground plane does not put the whole scene into one cell
+  float cellSize = BroadPhaseCellSize;
+  if (cellSize <= 0.0f) {
+    std::pmr::vector<float> extents(Core::GetScratchResource());
+    extents.reserve(bodies.size());
+    for (const Body &body : bodies) {
+      extents.push_back(body.extent);
+    }
+
+    auto percentile = extents.begin() + extents.size() * 9 / 10;
+    std::nth_element(extents.begin(), percentile, extents.end());
+    cellSize = std::max(*percentile, 1e-3f);
+  }
+  if (cellSize != m_BroadPhaseGrid.GetCellSize()) {
+    m_BroadPhaseGrid.SetCellSize(cellSize);
+  }
+
+  // Bodies spanning many cells stay out of the grid and are tested against
+  // every other body directly
+  const float oversizedExtent = cellSize * OversizedCellSpan;
+  std::pmr::vector<uint32_t> oversized(Core::GetScratchResource());
+
+  m_BroadPhaseGrid.Clear();
+  for (uint32_t i = 0; i < bodies.size(); ++i) {
+    const Body &body = bodies[i];
+    if (body.extent > oversizedExtent) {
+      oversized.push_back(i);
+    } else {
+      m_BroadPhaseGrid.Insert(body.entity, body.min, body.max);
+    }
+  }
+
+  // Unique overlapping pairs straight from the grid, as body indices
+  std::pmr::vector<SpatialHash::EntityPair> candidates(
+      Core::GetScratchResource());
+  m_BroadPhaseGrid.QueryPairs(candidates);
+
+  std::pmr::vector<uint32_t> bodyIndex(Core::GetScratchResource());
+  for (uint32_t i = 0; i < bodies.size(); ++i) {
+    const auto id = entt::to_entity(bodies[i].entity);
+    if (id >= bodyIndex.size())
+      bodyIndex.resize(id + 1);
+    bodyIndex[id] = i;
+  }
+
+  std::pmr::vector<std::pair<uint32_t, uint32_t>> overlaps(
+      Core::GetScratchResource());
+  overlaps.reserve(candidates.size());
+  for (const auto &candidate : candidates) {
+    overlaps.emplace_back(bodyIndex[entt::to_entity(candidate.EntityA)],
+                          bodyIndex[entt::to_entity(candidate.EntityB)]);
+  }
+
+  for (uint32_t large : oversized) {
+    const Body &a = bodies[large];
+    for (uint32_t i = 0; i < bodies.size(); ++i) {
+      const Body &b = bodies[i];
+      // Pairs of oversized bodies once, from the first of the two
+      if (b.extent > oversizedExtent && i <= large)
+        continue;
+
+      if (a.max.x < b.min.x || b.max.x < a.min.x || a.max.y < b.min.y ||
+          b.max.y < a.min.y || a.max.z < b.min.z || b.max.z < a.min.z)
+        continue;
+
+      overlaps.emplace_back(std::min(i, large), std::max(i, large));
+    }
+  }
+
+  // Report pairs in the order the all-pairs loop visits them, so contacts
+  // are solved in the same order whichever broad phase found them
+  std::sort(overlaps.begin(), overlaps.end());
+
+  for (const auto &[i, j] : overlaps) {
+    const auto &p1 = view.get<XPBDParticleComponent>(bodies[i].entity);
+    const auto &p2 = view.get<XPBDParticleComponent>(bodies[j].entity);
+    if ((p1.IsSleeping && p2.IsSleeping) || (p1.IsStatic() && p2.IsStatic())) {
+      continue;
+    }
+
+    pairs.push_back({bodies[i].entity, bodies[j].entity});
+  }
+}
+
+void XPBDSolver::ComputeBounds(const ColliderComponent &collider,
+                               const vec3 &position, vec3 &min, vec3 &max) {
+  vec3 center = position;
+  vec3 halfExtents(0.0f);
+
+  if (const auto *sphere = std::get_if<SphereCollider>(&collider.Shape)) {
+    center += sphere->Offset;
+    halfExtents = vec3(sphere->Radius);
+  } else if (const auto *box = std::get_if<BoxCollider>(&collider.Shape)) {
+    center += box->Offset;
+    halfExtents = box->HalfExtents;
+  } else if (const auto *capsule =
+                 std::get_if<CapsuleCollider>(&collider.Shape)) {
+    center += capsule->Offset;
+    halfExtents = vec3(capsule->Radius,
+                       capsule->Radius + capsule->Height * 0.5f,
+                       capsule->Radius);
+  }
+
+  min = center - halfExtents;
+  max = center + halfExtents;
+}
+
+template <typename Particles>
+bool XPBDSolver::NarrowPhaseCollision(Scene *scene, const Particles &particles,
+                                      const CollisionPair &pair,
                                       ContactConstraint &contact) {
   auto &registry = scene->Registry();
 
@@ -680,10 +1441,11 @@ bool XPBDSolver::NarrowPhaseCollision(Scene *scene, const CollisionPair &pair,
   auto *t2 = registry.try_get<TransformComponent>(pair.EntityB);
   auto *c1 = registry.try_get<ColliderComponent>(pair.EntityA);
   auto *c2 = registry.try_get<ColliderComponent>(pair.EntityB);
-  auto *p1 = registry.try_get<XPBDParticleComponent>(pair.EntityA);
-  auto *p2 = registry.try_get<XPBDParticleComponent>(pair.EntityB);
+  const auto p1 = particles.Find(pair.EntityA);
+  const auto p2 = particles.Find(pair.EntityB);
 
-  if (!t1 || !t2 || !c1 || !c2 || !p1 || !p2)
+  if (!t1 || !t2 || !c1 || !c2 || !particles.IsValid(p1) ||
+      !particles.IsValid(p2))
     return false;
 
   // Use existing collision detection from PhysicsSystem
@@ -692,8 +1454,8 @@ bool XPBDSolver::NarrowPhaseCollision(Scene *scene, const CollisionPair &pair,
     const auto &s1 = std::get<SphereCollider>(c1->Shape);
     const auto &s2 = std::get<SphereCollider>(c2->Shape);
 
-    vec3 pos1 = p1->Position + s1.Offset;
-    vec3 pos2 = p2->Position + s2.Offset;
+    vec3 pos1 = particles.Position(p1) + s1.Offset;
+    vec3 pos2 = particles.Position(p2) + s2.Offset;
 
     vec3 delta = pos2 - pos1;
     float distSq = Math::LengthSq(delta);
@@ -5,9 +5,17 @@
 //#include "Core/Math/Math.h"
 #include "Core/Memory/LinearAllocator.h"
 #include "Core/Memory/PoolAllocator.h"
+#include "Core/Memory/ObjectPool.h"
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Memory/StackAllocator.h"
+#include "Core/Memory/TLSFAllocator.h"
 
 
 #include "Core/Threading/ThreadPool.h"
+#include "Core/Threading/JobSystem.h"
+#include "Core/Threading/ParallelFor.h"
+#include "Core/Threading/Task.h"
+#include "Core/Threading/MainThreadScheduler.h"
 //#include "Core/Utils/Config.h"
 //#include "Core/Utils/FileSystem.h"
 #include "Core/Utils/StringUtils.h"
@@ -0,0 +1,552 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+
+// Register types and batch kernels over plain float arrays. Nothing here
+// depends on Math.h (DirectXMath), so the backends build with any compiler;
+// Core/Math/SIMDMath.h adds the vec3/quat/mat4 overloads on top.
+//
+// Backend selection: AVX2 when the compiler targets it, SSE on any x64 target,
+// NEON on ARM, scalar otherwise (or when YAMEN_SIMD_SCALAR is defined).
+// Only SSE2-level instructions are used, so the SSE path needs no /arch flag.
+#if !defined(YAMEN_SIMD_SCALAR)
+#if defined(__AVX2__)
+#define YAMEN_SIMD_AVX2 1
+#define YAMEN_SIMD_SSE 1
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) ||                                 \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define YAMEN_SIMD_SSE 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define YAMEN_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+#endif
+
+namespace Yamen {
+namespace Core {
+namespace simd {
+
+#if defined(YAMEN_SIMD_AVX2)
+inline constexpr const char *BackendName = "AVX2";
+#elif defined(YAMEN_SIMD_SSE)
+inline constexpr const char *BackendName = "SSE";
+#elif defined(YAMEN_SIMD_NEON)
+inline constexpr const char *BackendName = "NEON";
+#else
+inline constexpr const char *BackendName = "Scalar";
+#endif
+
+// ============================================================================
+// Float4: four floats in one register
+// ============================================================================
+
+struct Float4 {
+  static constexpr size_t Lanes = 4;
+
+#if defined(YAMEN_SIMD_SSE)
+  __m128 v;
+
+  static Float4 Load(const float *p) { return {_mm_loadu_ps(p)}; }
+  static Float4 Broadcast(float s) { return {_mm_set1_ps(s)}; }
+  void Store(float *p) const { _mm_storeu_ps(p, v); }
+#elif defined(YAMEN_SIMD_NEON)
+  float32x4_t v;
+
+  static Float4 Load(const float *p) { return {vld1q_f32(p)}; }
+  static Float4 Broadcast(float s) { return {vdupq_n_f32(s)}; }
+  void Store(float *p) const { vst1q_f32(p, v); }
+#else
+  float v[4];
+
+  static Float4 Load(const float *p) { return {{p[0], p[1], p[2], p[3]}}; }
+  static Float4 Broadcast(float s) { return {{s, s, s, s}}; }
+  void Store(float *p) const {
+    for (size_t i = 0; i < 4; ++i)
+      p[i] = v[i];
+  }
+#endif
+};
+
+#if defined(YAMEN_SIMD_SSE)
+inline Float4 operator+(Float4 a, Float4 b) { return {_mm_add_ps(a.v, b.v)}; }
+inline Float4 operator-(Float4 a, Float4 b) { return {_mm_sub_ps(a.v, b.v)}; }
+inline Float4 operator*(Float4 a, Float4 b) { return {_mm_mul_ps(a.v, b.v)}; }
+inline Float4 operator/(Float4 a, Float4 b) { return {_mm_div_ps(a.v, b.v)}; }
+inline Float4 Sqrt(Float4 a) { return {_mm_sqrt_ps(a.v)}; }
+inline Float4 Min(Float4 a, Float4 b) { return {_mm_min_ps(a.v, b.v)}; }
+inline Float4 Max(Float4 a, Float4 b) { return {_mm_max_ps(a.v, b.v)}; }
+
+// a / b where b > 0, zero elsewhere
+inline Float4 DivideIfPositive(Float4 a, Float4 b) {
+  const __m128 positive = _mm_cmpgt_ps(b.v, _mm_setzero_ps());
+  return {_mm_and_ps(_mm_div_ps(a.v, b.v), positive)};
+}
+#elif defined(YAMEN_SIMD_NEON)
+inline Float4 operator+(Float4 a, Float4 b) { return {vaddq_f32(a.v, b.v)}; }
+inline Float4 operator-(Float4 a, Float4 b) { return {vsubq_f32(a.v, b.v)}; }
+inline Float4 operator*(Float4 a, Float4 b) { return {vmulq_f32(a.v, b.v)}; }
+inline Float4 operator/(Float4 a, Float4 b) { return {vdivq_f32(a.v, b.v)}; }
+inline Float4 Sqrt(Float4 a) { return {vsqrtq_f32(a.v)}; }
+inline Float4 Min(Float4 a, Float4 b) { return {vminq_f32(a.v, b.v)}; }
+inline Float4 Max(Float4 a, Float4 b) { return {vmaxq_f32(a.v, b.v)}; }
+
+inline Float4 DivideIfPositive(Float4 a, Float4 b) {
+  const uint32x4_t positive = vcgtq_f32(b.v, vdupq_n_f32(0.0f));
+  return {vreinterpretq_f32_u32(
+      vandq_u32(vreinterpretq_u32_f32(vdivq_f32(a.v, b.v)), positive))};
+}
+#else
+namespace detail {
+template <typename Op> inline Float4 Apply(Float4 a, Float4 b, Op op) {
+  return {{op(a.v[0], b.v[0]), op(a.v[1], b.v[1]), op(a.v[2], b.v[2]),
+           op(a.v[3], b.v[3])}};
+}
+} // namespace detail
+
+inline Float4 operator+(Float4 a, Float4 b) {
+  return detail::Apply(a, b, [](float x, float y) { return x + y; });
+}
+inline Float4 operator-(Float4 a, Float4 b) {
+  return detail::Apply(a, b, [](float x, float y) { return x - y; });
+}
+inline Float4 operator*(Float4 a, Float4 b) {
+  return detail::Apply(a, b, [](float x, float y) { return x * y; });
+}
+inline Float4 operator/(Float4 a, Float4 b) {
+  return detail::Apply(a, b, [](float x, float y) { return x / y; });
+}
+inline Float4 Sqrt(Float4 a) {
+  return {{std::sqrt(a.v[0]), std::sqrt(a.v[1]), std::sqrt(a.v[2]),
+           std::sqrt(a.v[3])}};
+}
+inline Float4 Min(Float4 a, Float4 b) {
+  return detail::Apply(a, b, [](float x, float y) { return y < x ? y : x; });
+}
+inline Float4 Max(Float4 a, Float4 b) {
+  return detail::Apply(a, b, [](float x, float y) { return x < y ? y : x; });
+}
+inline Float4 DivideIfPositive(Float4 a, Float4 b) {
+  return detail::Apply(a, b,
+                       [](float x, float y) { return y > 0.0f ? x / y : 0.0f; });
+}
+#endif
+
+// ============================================================================
+// Float8: eight floats, one AVX register or two Float4
+// ============================================================================
+
+struct Float8 {
+  static constexpr size_t Lanes = 8;
+
+#if defined(YAMEN_SIMD_AVX2)
+  __m256 v;
+
+  static Float8 Load(const float *p) { return {_mm256_loadu_ps(p)}; }
+  static Float8 Broadcast(float s) { return {_mm256_set1_ps(s)}; }
+  void Store(float *p) const { _mm256_storeu_ps(p, v); }
+#else
+  Float4 lo, hi;
+
+  static Float8 Load(const float *p) {
+    return {Float4::Load(p), Float4::Load(p + 4)};
+  }
+  static Float8 Broadcast(float s) {
+    return {Float4::Broadcast(s), Float4::Broadcast(s)};
+  }
+  void Store(float *p) const {
+    lo.Store(p);
+    hi.Store(p + 4);
+  }
+#endif
+};
+
+#if defined(YAMEN_SIMD_AVX2)
+inline Float8 operator+(Float8 a, Float8 b) { return {_mm256_add_ps(a.v, b.v)}; }
+inline Float8 operator-(Float8 a, Float8 b) { return {_mm256_sub_ps(a.v, b.v)}; }
+inline Float8 operator*(Float8 a, Float8 b) { return {_mm256_mul_ps(a.v, b.v)}; }
+inline Float8 operator/(Float8 a, Float8 b) { return {_mm256_div_ps(a.v, b.v)}; }
+inline Float8 Sqrt(Float8 a) { return {_mm256_sqrt_ps(a.v)}; }
+inline Float8 Min(Float8 a, Float8 b) { return {_mm256_min_ps(a.v, b.v)}; }
+inline Float8 Max(Float8 a, Float8 b) { return {_mm256_max_ps(a.v, b.v)}; }
+
+inline Float8 DivideIfPositive(Float8 a, Float8 b) {
+  const __m256 positive = _mm256_cmp_ps(b.v, _mm256_setzero_ps(), _CMP_GT_OQ);
+  return {_mm256_and_ps(_mm256_div_ps(a.v, b.v), positive)};
+}
+#else
+inline Float8 operator+(Float8 a, Float8 b) { return {a.lo + b.lo, a.hi + b.hi}; }
+inline Float8 operator-(Float8 a, Float8 b) { return {a.lo - b.lo, a.hi - b.hi}; }
+inline Float8 operator*(Float8 a, Float8 b) { return {a.lo * b.lo, a.hi * b.hi}; }
+inline Float8 operator/(Float8 a, Float8 b) { return {a.lo / b.lo, a.hi / b.hi}; }
+inline Float8 Sqrt(Float8 a) { return {Sqrt(a.lo), Sqrt(a.hi)}; }
+inline Float8 Min(Float8 a, Float8 b) { return {Min(a.lo, b.lo), Min(a.hi, b.hi)}; }
+inline Float8 Max(Float8 a, Float8 b) { return {Max(a.lo, b.lo), Max(a.hi, b.hi)}; }
+inline Float8 DivideIfPositive(Float8 a, Float8 b) {
+  return {DivideIfPositive(a.lo, b.lo), DivideIfPositive(a.hi, b.hi)};
+}
+#endif
+
+// ============================================================================
+// AoS <-> SoA transposition
+// ============================================================================
+
+// Load four packed xyz triples (12 floats) as x, y and z registers
+inline void LoadXYZ(const float *p, Float4 &x, Float4 &y, Float4 &z) {
+#if defined(YAMEN_SIMD_SSE)
+  const __m128 a = _mm_loadu_ps(p);     // x0 y0 z0 x1
+  const __m128 b = _mm_loadu_ps(p + 4); // y1 z1 x2 y2
+  const __m128 c = _mm_loadu_ps(p + 8); // z2 x3 y3 z3
+  x.v = _mm_shuffle_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 3, 0)),
+                       _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)),
+                       _MM_SHUFFLE(2, 0, 1, 0));
+  y.v = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)),
+                       _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)),
+                       _MM_SHUFFLE(2, 0, 2, 0));
+  z.v = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)),
+                       _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)),
+                       _MM_SHUFFLE(2, 0, 2, 0));
+#elif defined(YAMEN_SIMD_NEON)
+  const float32x4x3_t v = vld3q_f32(p);
+  x.v = v.val[0];
+  y.v = v.val[1];
+  z.v = v.val[2];
+#else
+  for (size_t i = 0; i < 4; ++i) {
+    x.v[i] = p[i * 3 + 0];
+    y.v[i] = p[i * 3 + 1];
+    z.v[i] = p[i * 3 + 2];
+  }
+#endif
+}
+
+inline void StoreXYZ(float *p, Float4 x, Float4 y, Float4 z) {
+#if defined(YAMEN_SIMD_SSE)
+  const __m128 xyLo = _mm_unpacklo_ps(x.v, y.v); // x0 y0 x1 y1
+  const __m128 xyHi = _mm_unpackhi_ps(x.v, y.v); // x2 y2 x3 y3
+  const __m128 z0x1 = _mm_shuffle_ps(z.v, x.v, _MM_SHUFFLE(1, 1, 0, 0));
+  const __m128 y1z1 = _mm_shuffle_ps(y.v, z.v, _MM_SHUFFLE(1, 1, 1, 1));
+  const __m128 z2z3 = _mm_shuffle_ps(z.v, xyHi, _MM_SHUFFLE(3, 2, 3, 2));
+  _mm_storeu_ps(p, _mm_shuffle_ps(xyLo, z0x1, _MM_SHUFFLE(2, 0, 1, 0)));
+  _mm_storeu_ps(p + 4, _mm_shuffle_ps(y1z1, xyHi, _MM_SHUFFLE(1, 0, 2, 0)));
+  _mm_storeu_ps(p + 8, _mm_shuffle_ps(z2z3, z2z3, _MM_SHUFFLE(1, 3, 2, 0)));
+#elif defined(YAMEN_SIMD_NEON)
+  float32x4x3_t v;
+  v.val[0] = x.v;
+  v.val[1] = y.v;
+  v.val[2] = z.v;
+  vst3q_f32(p, v);
+#else
+  for (size_t i = 0; i < 4; ++i) {
+    p[i * 3 + 0] = x.v[i];
+    p[i * 3 + 1] = y.v[i];
+    p[i * 3 + 2] = z.v[i];
+  }
+#endif
+}
+
+// Load four packed xyzw quadruples as x, y, z and w registers
+inline void LoadXYZW(const float *p, Float4 &x, Float4 &y, Float4 &z,
+                     Float4 &w) {
+#if defined(YAMEN_SIMD_SSE)
+  __m128 r0 = _mm_loadu_ps(p), r1 = _mm_loadu_ps(p + 4);
+  __m128 r2 = _mm_loadu_ps(p + 8), r3 = _mm_loadu_ps(p + 12);
+  _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+  x.v = r0;
+  y.v = r1;
+  z.v = r2;
+  w.v = r3;
+#elif defined(YAMEN_SIMD_NEON)
+  const float32x4x4_t v = vld4q_f32(p);
+  x.v = v.val[0];
+  y.v = v.val[1];
+  z.v = v.val[2];
+  w.v = v.val[3];
+#else
+  for (size_t i = 0; i < 4; ++i) {
+    x.v[i] = p[i * 4 + 0];
+    y.v[i] = p[i * 4 + 1];
+    z.v[i] = p[i * 4 + 2];
+    w.v[i] = p[i * 4 + 3];
+  }
+#endif
+}
+
+inline void StoreXYZW(float *p, Float4 x, Float4 y, Float4 z, Float4 w) {
+#if defined(YAMEN_SIMD_SSE)
+  _MM_TRANSPOSE4_PS(x.v, y.v, z.v, w.v);
+  _mm_storeu_ps(p, x.v);
+  _mm_storeu_ps(p + 4, y.v);
+  _mm_storeu_ps(p + 8, z.v);
+  _mm_storeu_ps(p + 12, w.v);
+#elif defined(YAMEN_SIMD_NEON)
+  float32x4x4_t v;
+  v.val[0] = x.v;
+  v.val[1] = y.v;
+  v.val[2] = z.v;
+  v.val[3] = w.v;
+  vst4q_f32(p, v);
+#else
+  for (size_t i = 0; i < 4; ++i) {
+    p[i * 4 + 0] = x.v[i];
+    p[i * 4 + 1] = y.v[i];
+    p[i * 4 + 2] = z.v[i];
+    p[i * 4 + 3] = w.v[i];
+  }
+#endif
+}
+
+#if defined(YAMEN_SIMD_AVX2)
+inline void LoadXYZ(const float *p, Float8 &x, Float8 &y, Float8 &z) {
+  Float4 x0, y0, z0, x1, y1, z1;
+  LoadXYZ(p, x0, y0, z0);
+  LoadXYZ(p + 12, x1, y1, z1);
+  x.v = _mm256_set_m128(x1.v, x0.v);
+  y.v = _mm256_set_m128(y1.v, y0.v);
+  z.v = _mm256_set_m128(z1.v, z0.v);
+}
+
+inline void StoreXYZ(float *p, Float8 x, Float8 y, Float8 z) {
+  StoreXYZ(p, {_mm256_castps256_ps128(x.v)}, {_mm256_castps256_ps128(y.v)},
+           {_mm256_castps256_ps128(z.v)});
+  StoreXYZ(p + 12, {_mm256_extractf128_ps(x.v, 1)},
+           {_mm256_extractf128_ps(y.v, 1)}, {_mm256_extractf128_ps(z.v, 1)});
+}
+
+inline void LoadXYZW(const float *p, Float8 &x, Float8 &y, Float8 &z,
+                     Float8 &w) {
+  Float4 x0, y0, z0, w0, x1, y1, z1, w1;
+  LoadXYZW(p, x0, y0, z0, w0);
+  LoadXYZW(p + 16, x1, y1, z1, w1);
+  x.v = _mm256_set_m128(x1.v, x0.v);
+  y.v = _mm256_set_m128(y1.v, y0.v);
+  z.v = _mm256_set_m128(z1.v, z0.v);
+  w.v = _mm256_set_m128(w1.v, w0.v);
+}
+
+inline void StoreXYZW(float *p, Float8 x, Float8 y, Float8 z, Float8 w) {
+  StoreXYZW(p, {_mm256_castps256_ps128(x.v)}, {_mm256_castps256_ps128(y.v)},
+            {_mm256_castps256_ps128(z.v)}, {_mm256_castps256_ps128(w.v)});
+  StoreXYZW(p + 16, {_mm256_extractf128_ps(x.v, 1)},
+            {_mm256_extractf128_ps(y.v, 1)}, {_mm256_extractf128_ps(z.v, 1)},
+            {_mm256_extractf128_ps(w.v, 1)});
+}
+#else
+inline void LoadXYZ(const float *p, Float8 &x, Float8 &y, Float8 &z) {
+  LoadXYZ(p, x.lo, y.lo, z.lo);
+  LoadXYZ(p + 12, x.hi, y.hi, z.hi);
+}
+
+inline void StoreXYZ(float *p, Float8 x, Float8 y, Float8 z) {
+  StoreXYZ(p, x.lo, y.lo, z.lo);
+  StoreXYZ(p + 12, x.hi, y.hi, z.hi);
+}
+
+inline void LoadXYZW(const float *p, Float8 &x, Float8 &y, Float8 &z,
+                     Float8 &w) {
+  LoadXYZW(p, x.lo, y.lo, z.lo, w.lo);
+  LoadXYZW(p + 16, x.hi, y.hi, z.hi, w.hi);
+}
+
+inline void StoreXYZW(float *p, Float8 x, Float8 y, Float8 z, Float8 w) {
+  StoreXYZW(p, x.lo, y.lo, z.lo, w.lo);
+  StoreXYZW(p + 16, x.hi, y.hi, z.hi, w.hi);
+}
+#endif
+
+// ============================================================================
+// Vec3xN / QuatxN: N vectors in structure-of-arrays form
+// ============================================================================
+
+/**
+ * @brief N three-component vectors, one register per component
+ *
+ * Values stay in registers across operations; memory is only touched by the
+ * explicit Load/Store calls, from packed xyz triples (AoS) or separate
+ * x/y/z arrays (SoA).
+ */
+template <typename F> struct Vec3xN {
+  static constexpr size_t Lanes = F::Lanes;
+
+  F x, y, z;
+
+  static Vec3xN Broadcast(float vx, float vy, float vz) {
+    return {F::Broadcast(vx), F::Broadcast(vy), F::Broadcast(vz)};
+  }
+
+  // Lanes consecutive xyz triples
+  static Vec3xN LoadAoS(const float *p) {
+    Vec3xN r;
+    LoadXYZ(p, r.x, r.y, r.z);
+    return r;
+  }
+  void StoreAoS(float *p) const { StoreXYZ(p, x, y, z); }
+
+  static Vec3xN LoadSoA(const float *xs, const float *ys, const float *zs) {
+    return {F::Load(xs), F::Load(ys), F::Load(zs)};
+  }
+  void StoreSoA(float *xs, float *ys, float *zs) const {
+    x.Store(xs);
+    y.Store(ys);
+    z.Store(zs);
+  }
+};
+
+template <typename F>
+inline Vec3xN<F> operator+(const Vec3xN<F> &a, const Vec3xN<F> &b) {
+  return {a.x + b.x, a.y + b.y, a.z + b.z};
+}
+template <typename F>
+inline Vec3xN<F> operator-(const Vec3xN<F> &a, const Vec3xN<F> &b) {
+  return {a.x - b.x, a.y - b.y, a.z - b.z};
+}
+template <typename F>
+inline Vec3xN<F> operator*(const Vec3xN<F> &a, const Vec3xN<F> &b) {
+  return {a.x * b.x, a.y * b.y, a.z * b.z};
+}
+template <typename F> inline Vec3xN<F> operator*(const Vec3xN<F> &a, F s) {
+  return {a.x * s, a.y * s, a.z * s};
+}
+
+template <typename F> inline F Dot(const Vec3xN<F> &a, const Vec3xN<F> &b) {
+  return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+template <typename F>
+inline Vec3xN<F> Cross(const Vec3xN<F> &a, const Vec3xN<F> &b) {
+  return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+          a.x * b.y - a.y * b.x};
+}
+
+template <typename F> inline F LengthSq(const Vec3xN<F> &v) { return Dot(v, v); }
+template <typename F> inline F Length(const Vec3xN<F> &v) {
+  return Sqrt(Dot(v, v));
+}
+
+// Zero-length vectors normalize to zero, as with Math::Normalize
+template <typename F> inline Vec3xN<F> Normalize(const Vec3xN<F> &v) {
+  const F inv = DivideIfPositive(F::Broadcast(1.0f), Length(v));
+  return v * inv;
+}
+
+/**
+ * @brief N quaternions, one register per component
+ */
+template <typename F> struct QuatxN {
+  static constexpr size_t Lanes = F::Lanes;
+
+  F x, y, z, w;
+
+  static QuatxN Broadcast(const float *q) {
+    return {F::Broadcast(q[0]), F::Broadcast(q[1]), F::Broadcast(q[2]),
+            F::Broadcast(q[3])};
+  }
+
+  // Lanes consecutive xyzw quadruples
+  static QuatxN LoadAoS(const float *p) {
+    QuatxN r;
+    LoadXYZW(p, r.x, r.y, r.z, r.w);
+    return r;
+  }
+};
+
+// v' = v + w t + q.xyz x t, with t = 2 (q.xyz x v); q must be unit length
+template <typename F>
+inline Vec3xN<F> Rotate(const QuatxN<F> &q, const Vec3xN<F> &v) {
+  const Vec3xN<F> axis{q.x, q.y, q.z};
+  const Vec3xN<F> t = Cross(axis, v) * F::Broadcast(2.0f);
+  return v + t * q.w + Cross(axis, t);
+}
+
+/**
+ * @brief Affine transform of N points by a row-vector matrix (p * M)
+ *
+ * m is 16 floats, row-major, translation in the last row (as XMFLOAT4X4).
+ */
+template <typename F>
+inline Vec3xN<F> TransformPoint(const float *m, const Vec3xN<F> &p) {
+  return {p.x * F::Broadcast(m[0]) + p.y * F::Broadcast(m[4]) +
+              p.z * F::Broadcast(m[8]) + F::Broadcast(m[12]),
+          p.x * F::Broadcast(m[1]) + p.y * F::Broadcast(m[5]) +
+              p.z * F::Broadcast(m[9]) + F::Broadcast(m[13]),
+          p.x * F::Broadcast(m[2]) + p.y * F::Broadcast(m[6]) +
+              p.z * F::Broadcast(m[10]) + F::Broadcast(m[14])};
+}
+
+/**
+ * @brief Transform of N directions (no translation)
+ */
+template <typename F>
+inline Vec3xN<F> TransformVector(const float *m, const Vec3xN<F> &v) {
+  return {v.x * F::Broadcast(m[0]) + v.y * F::Broadcast(m[4]) +
+              v.z * F::Broadcast(m[8]),
+          v.x * F::Broadcast(m[1]) + v.y * F::Broadcast(m[5]) +
+              v.z * F::Broadcast(m[9]),
+          v.x * F::Broadcast(m[2]) + v.y * F::Broadcast(m[6]) +
+              v.z * F::Broadcast(m[10])};
+}
+
+using Vec3x4 = Vec3xN<Float4>;
+using Vec3x8 = Vec3xN<Float8>;
+using Quatx4 = QuatxN<Float4>;
+using Quatx8 = QuatxN<Float8>;
+
+// ============================================================================
+// Batch kernels over packed arrays
+//
+// Vectors are count packed xyz triples, quaternions xyzw quadruples and
+// matrices 16 floats as for TransformPoint. Each kernel processes eight
+// elements per step in registers, including the tail. Outputs may alias the
+// inputs exactly (in-place), but must not otherwise overlap.
+// ============================================================================
+
+/**
+ * @brief out[i] = points[i] * m (affine; the projective row is ignored)
+ */
+void TransformPoints(const float *m, const float *points, float *out,
+                     size_t count);
+
+/**
+ * @brief out[i] = vectors[i] * m without translation
+ */
+void TransformVectors(const float *m, const float *vectors, float *out,
+                      size_t count);
+
+/**
+ * @brief out[i] = dot(a[i], b[i]), one float per element
+ */
+void Dot(const float *a, const float *b, float *out, size_t count);
+
+/**
+ * @brief out[i] = cross(a[i], b[i])
+ */
+void Cross(const float *a, const float *b, float *out, size_t count);
+
+/**
+ * @brief out[i] = normalize(v[i]), zero for zero-length vectors
+ */
+void Normalize(const float *v, float *out, size_t count);
+
+/**
+ * @brief out[i] = rotate(q, v[i]) for a single quaternion q
+ */
+void RotateAll(const float *q, const float *v, float *out, size_t count);
+
+/**
+ * @brief out[i] = rotate(q[i], v[i])
+ */
+void Rotate(const float *q, const float *v, float *out, size_t count);
+
+/**
+ * @brief out[i] = Translate(t[i]) * ToMat4(r[i]) * Scale(s[i])
+ *
+ * Same composition as TransformComponent::GetTransform; rotations must be unit
+ * quaternions.
+ */
+void ComposeTransforms(const float *translations, const float *rotations,
+                       const float *scales, float *out, size_t count);
+
+} // namespace simd
+} // namespace Core
+} // namespace Yamen
@@ -0,0 +1,99 @@
+#pragma once
+#include "Core/Math/Math.h"
+#include "Core/Math/SIMD.h"
+#include <algorithm>
+#include <span>
+
+// Core::Math overloads of the simd batch kernels. The kernels work on packed
+// floats; these views of vec3/quat/mat4 arrays rely on the layouts checked
+// below. Element counts are the shortest of the spans passed.
+
+namespace Yamen {
+namespace Core {
+namespace simd {
+
+static_assert(sizeof(vec3) == 3 * sizeof(float), "vec3 must be three packed floats");
+static_assert(sizeof(quat) == 4 * sizeof(float), "quat must be four packed floats");
+static_assert(sizeof(mat4) == 16 * sizeof(float), "mat4 must be sixteen packed floats");
+
+namespace detail {
+template <typename T> const float *Floats(std::span<const T> s) {
+  return reinterpret_cast<const float *>(s.data());
+}
+template <typename T> float *Floats(std::span<T> s) {
+  return reinterpret_cast<float *>(s.data());
+}
+} // namespace detail
+
+template <typename F> inline Vec3xN<F> Broadcast(const vec3 &v) {
+  return Vec3xN<F>::Broadcast(v.x, v.y, v.z);
+}
+
+template <typename F> inline QuatxN<F> Broadcast(const quat &q) {
+  return QuatxN<F>::Broadcast(&q.x);
+}
+
+template <typename F>
+inline Vec3xN<F> TransformPoint(const mat4 &m, const Vec3xN<F> &p) {
+  return TransformPoint(&m._11, p);
+}
+
+template <typename F>
+inline Vec3xN<F> TransformVector(const mat4 &m, const Vec3xN<F> &v) {
+  return TransformVector(&m._11, v);
+}
+
+inline void TransformPoints(const mat4 &m, std::span<const vec3> points,
+                            std::span<vec3> out) {
+  TransformPoints(&m._11, detail::Floats(points), detail::Floats(out),
+                  std::min(points.size(), out.size()));
+}
+
+inline void TransformVectors(const mat4 &m, std::span<const vec3> vectors,
+                             std::span<vec3> out) {
+  TransformVectors(&m._11, detail::Floats(vectors), detail::Floats(out),
+                   std::min(vectors.size(), out.size()));
+}
+
+inline void Dot(std::span<const vec3> a, std::span<const vec3> b,
+                std::span<float> out) {
+  Dot(detail::Floats(a), detail::Floats(b), out.data(),
+      std::min({a.size(), b.size(), out.size()}));
+}
+
+inline void Cross(std::span<const vec3> a, std::span<const vec3> b,
+                  std::span<vec3> out) {
+  Cross(detail::Floats(a), detail::Floats(b), detail::Floats(out),
+        std::min({a.size(), b.size(), out.size()}));
+}
+
+inline void Normalize(std::span<const vec3> v, std::span<vec3> out) {
+  Normalize(detail::Floats(v), detail::Floats(out),
+            std::min(v.size(), out.size()));
+}
+
+inline void Rotate(const quat &q, std::span<const vec3> v,
+                   std::span<vec3> out) {
+  RotateAll(&q.x, detail::Floats(v), detail::Floats(out),
+            std::min(v.size(), out.size()));
+}
+
+inline void Rotate(std::span<const quat> q, std::span<const vec3> v,
+                   std::span<vec3> out) {
+  Rotate(detail::Floats(q), detail::Floats(v), detail::Floats(out),
+         std::min({q.size(), v.size(), out.size()}));
+}
+
+inline void ComposeTransforms(std::span<const vec3> translations,
+                              std::span<const quat> rotations,
+                              std::span<const vec3> scales,
+                              std::span<mat4> out) {
+  ComposeTransforms(detail::Floats(translations), detail::Floats(rotations),
+                    detail::Floats(scales), detail::Floats(out),
+                    std::min({translations.size(), rotations.size(),
+                              scales.size(), out.size()}));
+}
+
+} // namespace simd
+} // namespace Core
+} // namespace Yamen
@@ -0,0 +1,157 @@
+#pragma once
+
+#include "Core/Memory/LinearAllocator.h"
+#include "Core/Memory/MemoryTracker.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Yamen::Core {
+
+/**
+ * @brief Multi-buffered per-frame arena
+ *
+ * Holds two or three frame buffers and rotates through them in BeginFrame(), so
+ * memory handed out in frame N stays valid while frame N+1 is built (and N+2 with
+ * three buffers). Nothing is freed individually and no destructors run; a buffer
+ * is reset as a whole when it comes round again.
+ *
+ * Allocate() may be called from any thread, including from inside parallel jobs.
+ * Each thread bump-allocates from its own sub-arena (a LinearAllocator over a chunk
+ * of the frame buffer); only claiming a new chunk touches shared state, with a
+ * single atomic. If a frame runs out of space, the excess comes from the heap for
+ * that frame and the buffers grow to the high-water mark when they are recycled.
+ *
+ * It is also a std::pmr::memory_resource (deallocation is a no-op), so per-frame
+ * scratch containers can be std::pmr containers over it; see ScopedScratchResource.
+ *
+ * BeginFrame() must not overlap with allocations from other threads.
+ */
+class FrameAllocator : public std::pmr::memory_resource {
+public:
+    static constexpr uint32_t MaxFramesInFlight = 3;
+    static constexpr size_t SubArenaSize = 64 * 1024;
+    static constexpr size_t MaxSubArenaAllocation = SubArenaSize / 4;  // Larger requests bump the frame buffer directly
+    static constexpr size_t BufferAlignment = 64;
+
+    /**
+     * @brief Construct frame allocator
+     * @param capacity Initial size of each frame buffer in bytes
+     * @param framesInFlight Number of frame buffers (2 or 3)
+     * @param tag Memory tag the buffers are charged to
+     */
+    explicit FrameAllocator(size_t capacity = 4 * 1024 * 1024, uint32_t framesInFlight = 2,
+        MemoryTag tag = MemoryTracker::GetCurrentTag());
+    ~FrameAllocator() override;
+
+    // Non-copyable, non-movable: outstanding allocations point into the buffers
+    FrameAllocator(const FrameAllocator&) = delete;
+    FrameAllocator& operator=(const FrameAllocator&) = delete;
+    FrameAllocator(FrameAllocator&&) = delete;
+    FrameAllocator& operator=(FrameAllocator&&) = delete;
+
+    /**
+     * @brief Advance to the next frame buffer, releasing what it held frames ago
+     */
+    void BeginFrame();
+
+    /**
+     * @brief Allocate memory valid until this buffer is recycled
+     * @param size Size in bytes
+     * @param alignment Alignment requirement (must be power of 2)
+     */
+    [[nodiscard]] void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * @brief Construct a T in frame memory (its destructor is never run)
+     */
+    template<typename T, typename... Args>
+    [[nodiscard]] T* New(Args&&... args) {
+        static_assert(std::is_trivially_destructible_v<T>, "Frame memory never runs destructors");
+        return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Allocate a default-initialized array in frame memory
+     */
+    template<typename T>
+    [[nodiscard]] std::span<T> NewArray(size_t count) {
+        static_assert(std::is_trivially_destructible_v<T>, "Frame memory never runs destructors");
+        T* data = static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+        std::uninitialized_default_construct_n(data, count);
+        return { data, count };
+    }
+
+    /**
+     * @brief Get the size of each frame buffer
+     */
+    [[nodiscard]] size_t GetCapacity() const noexcept { return m_Capacity; }
+
+    /**
+     * @brief Get bytes used so far in the current frame, including heap overflow
+     */
+    [[nodiscard]] size_t GetUsedSize() const noexcept;
+
+    /**
+     * @brief Get the most bytes any completed frame has used
+     */
+    [[nodiscard]] size_t GetHighWaterMark() const noexcept { return m_HighWaterMark; }
+
+    /**
+     * @brief Get number of BeginFrame() calls so far
+     */
+    [[nodiscard]] uint64_t GetFrameNumber() const noexcept { return m_FrameNumber; }
+
+    [[nodiscard]] uint32_t GetFramesInFlight() const noexcept { return m_FramesInFlight; }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override { return Allocate(bytes, alignment); }
+    void do_deallocate(void*, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+private:
+    struct alignas(64) SubArena {
+        LinearAllocator arena;
+    };
+
+    struct OverflowBlock {
+        void* memory;
+        size_t size;
+        size_t alignment;
+    };
+
+    struct FrameBuffer {
+        uint8_t* memory = nullptr;
+        size_t capacity = 0;
+        std::atomic<size_t> offset{ 0 };
+        std::atomic<size_t> overflowBytes{ 0 };
+
+        std::mutex overflowMutex;
+        std::vector<OverflowBlock> overflow;
+
+        std::unique_ptr<SubArena[]> subArenas;
+    };
+
+    void* AllocateShared(FrameBuffer& frame, size_t size, size_t alignment);
+    void ResetBuffer(FrameBuffer& frame);
+    void ReleaseOverflow(FrameBuffer& frame) noexcept;
+
+    std::array<FrameBuffer, MaxFramesInFlight> m_Frames;
+    uint32_t m_FramesInFlight = 2;
+    uint32_t m_CurrentFrame = 0;
+    uint64_t m_FrameNumber = 0;
+    size_t m_Capacity = 0;
+    size_t m_HighWaterMark = 0;
+    MemoryTag m_Tag;
+};
+
+} // namespace Yamen::Core
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Core/Memory/MemoryTracker.h"
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -16,7 +17,13 @@ namespace Yamen::Core {
  */
 class LinearAllocator {
 public:
-    explicit LinearAllocator(size_t capacity);
+    LinearAllocator() noexcept = default;
+    explicit LinearAllocator(size_t capacity, MemoryTag tag = MemoryTracker::GetCurrentTag());
+
+    /**
+     * @brief Allocate from caller-owned memory (not freed by the allocator)
+     */
+    LinearAllocator(void* buffer, size_t capacity) noexcept;
     ~LinearAllocator();
 
     // Non-copyable
@@ -55,10 +62,20 @@ public:
      */
     [[nodiscard]] bool CanAllocate(size_t size, size_t alignment = alignof(std::max_align_t)) const noexcept;
 
+    /**
+     * @brief Check if a pointer lies inside this allocator's buffer
+     */
+    [[nodiscard]] bool Owns(const void* ptr) const noexcept {
+        const auto* bytes = static_cast<const uint8_t*>(ptr);
+        return m_Buffer && bytes >= m_Buffer && bytes < m_Buffer + m_Capacity;
+    }
+
 private:
     uint8_t* m_Buffer = nullptr;
     size_t m_Capacity = 0;
     size_t m_Offset = 0;
+    bool m_OwnsBuffer = false;
+    MemoryTag m_Tag = MemoryTag::General;
 };
 
 /**
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "Core/Memory/LinearAllocator.h"
+#include "Core/Memory/PoolAllocator.h"
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace Yamen::Core {
+
+/**
+ * @brief std::pmr adapter over a LinearAllocator
+ *
+ * Deallocation is a no-op; memory comes back when the LinearAllocator is Reset().
+ * Requests that do not fit go to @p upstream (by default none: they throw
+ * std::bad_alloc), and blocks from upstream are returned to it.
+ */
+class LinearMemoryResource : public std::pmr::memory_resource {
+public:
+    explicit LinearMemoryResource(LinearAllocator& allocator,
+        std::pmr::memory_resource* upstream = std::pmr::null_memory_resource()) noexcept
+        : m_Allocator(allocator), m_Upstream(upstream) {
+    }
+
+    [[nodiscard]] LinearAllocator& GetAllocator() const noexcept { return m_Allocator; }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+private:
+    LinearAllocator& m_Allocator;
+    std::pmr::memory_resource* m_Upstream;
+};
+
+/**
+ * @brief std::pmr adapter over a PoolAllocator
+ *
+ * Serves requests no larger than the pool's object size (and alignment) from the
+ * pool, which suits node-based containers such as std::pmr::list/map/unordered_map;
+ * everything else goes to @p upstream. Thread-safe, like the pool.
+ */
+class PoolMemoryResource : public std::pmr::memory_resource {
+public:
+    explicit PoolMemoryResource(PoolAllocator& pool,
+        std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept
+        : m_Pool(pool), m_Upstream(upstream) {
+    }
+
+    [[nodiscard]] PoolAllocator& GetPool() const noexcept { return m_Pool; }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+private:
+    bool Fits(size_t bytes, size_t alignment) const noexcept {
+        return bytes <= m_Pool.GetObjectSize() && alignment <= m_Pool.GetObjectAlignment();
+    }
+
+    PoolAllocator& m_Pool;
+    std::pmr::memory_resource* m_Upstream;
+};
+
+/**
+ * @brief Get the calling thread's scratch resource
+ *
+ * Short-lived containers should be built on this: it is the frame allocator while a
+ * ScopedScratchResource is active (e.g. during Scene updates), and the default
+ * resource otherwise.
+ */
+[[nodiscard]] std::pmr::memory_resource* GetScratchResource() noexcept;
+
+/**
+ * @brief Check if a ScopedScratchResource is active on the calling thread
+ */
+[[nodiscard]] bool HasScratchResource() noexcept;
+
+/**
+ * @brief Installs a scratch resource for the calling thread for its lifetime
+ *
+ * Nests; the previous resource is restored on destruction. A null resource
+ * installs nothing.
+ */
+class ScopedScratchResource {
+public:
+    explicit ScopedScratchResource(std::pmr::memory_resource* resource) noexcept;
+    ~ScopedScratchResource();
+
+    ScopedScratchResource(const ScopedScratchResource&) = delete;
+    ScopedScratchResource& operator=(const ScopedScratchResource&) = delete;
+
+private:
+    std::pmr::memory_resource* m_Previous;
+};
+
+/**
+ * @brief Monotonic resource over an inline buffer, for function-local scratch
+ *
+ * Lives on the stack; allocations bump through the buffer and spill to
+ * @p upstream (the scratch resource by default) once it is full. Everything is
+ * released when the resource goes out of scope.
+ *
+ * @code
+ * Core::StackBufferResource<4096> scratch;
+ * std::pmr::vector<entt::entity> found(&scratch);
+ * @endcode
+ */
+template<size_t Bytes>
+class StackBufferResource : public std::pmr::memory_resource {
+public:
+    explicit StackBufferResource(std::pmr::memory_resource* upstream = GetScratchResource()) noexcept
+        : m_Arena(m_Buffer, Bytes, upstream) {
+    }
+
+    StackBufferResource(const StackBufferResource&) = delete;
+    StackBufferResource& operator=(const StackBufferResource&) = delete;
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override { return m_Arena.allocate(bytes, alignment); }
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override { m_Arena.deallocate(ptr, bytes, alignment); }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+private:
+    alignas(std::max_align_t) std::byte m_Buffer[Bytes];
+    std::pmr::monotonic_buffer_resource m_Arena;
+};
+
+/**
+ * @brief Empty a per-update pmr container and point it at the current scratch resource
+ *
+ * Polymorphic allocators do not propagate on assignment, so a member container
+ * cannot simply be reassigned to a new resource. With a scratch resource active the
+ * container is rebuilt on it (its old storage belonged to an earlier frame);
+ * otherwise it is cleared and keeps its capacity.
+ */
+template<typename Container>
+void ResetForScratch(Container& container) {
+    std::pmr::memory_resource* scratch = GetScratchResource();
+    if (HasScratchResource() || container.get_allocator().resource() != scratch) {
+        std::destroy_at(&container);
+        std::construct_at(&container, scratch);
+    }
+    else {
+        container.clear();
+    }
+}
+
+} // namespace Yamen::Core
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Yamen::Core {
+
+/**
+ * @brief Subsystem an allocation is charged to
+ */
+enum class MemoryTag : uint8_t {
+    General,
+    Core,
+    ECS,
+    Physics,
+    Animation,
+    World,
+    Assets,
+    Graphics,
+    Network,
+    Count
+};
+
+/**
+ * @brief Get a tag's display name
+ */
+std::string_view ToString(MemoryTag tag) noexcept;
+
+/**
+ * @brief Counters for one tag
+ */
+struct MemoryTagStats {
+    int64_t liveBytes = 0;
+    int64_t peakBytes = 0;
+    uint64_t allocations = 0;
+    uint64_t frees = 0;
+};
+
+/**
+ * @brief Per-tag statistics at one point in time
+ */
+struct MemorySnapshot {
+    std::array<MemoryTagStats, static_cast<size_t>(MemoryTag::Count)> tags{};
+
+    const MemoryTagStats& operator[](MemoryTag tag) const noexcept { return tags[static_cast<size_t>(tag)]; }
+
+    /**
+     * @brief Get totals over all tags (peak is the sum of per-tag peaks)
+     */
+    MemoryTagStats Total() const noexcept;
+
+    /**
+     * @brief Get the change since @p baseline
+     *
+     * Live bytes and counts are differences; peak is this snapshot's peak.
+     */
+    MemorySnapshot Diff(const MemorySnapshot& baseline) const noexcept;
+
+    /**
+     * @brief Log one line per tag that has seen any activity
+     */
+    void Log(std::string_view title) const;
+};
+
+/**
+ * @brief Process-wide memory accounting by tag
+ *
+ * Engine allocators (PoolAllocator, LinearAllocator, FrameAllocator, SlabAllocator)
+ * report the memory they obtain from the system under the tag they were created
+ * with. Building with YAMEN_TRACK_MEMORY (premake --track-memory) also replaces the
+ * global operator new/delete so every heap allocation is charged to the calling
+ * thread's current tag (see ScopedMemoryTag).
+ *
+ * Counting goes to per-thread counters that are published to the global totals
+ * every 64 KB or 256 operations, so recording is a few plain stores. Snapshots add
+ * the unpublished per-thread counts. Peaks are updated on publish from each
+ * thread's high point in the batch, so they are approximate when several threads
+ * allocate under the same tag at once.
+ *
+ * The current tag is per thread: work handed to the ThreadPool is charged to the
+ * worker's tag unless the job sets its own.
+ */
+class MemoryTracker {
+public:
+    /**
+     * @brief Record memory obtained from the system
+     */
+    static void RecordAllocation(MemoryTag tag, size_t bytes) noexcept;
+
+    /**
+     * @brief Record memory returned to the system
+     */
+    static void RecordFree(MemoryTag tag, size_t bytes) noexcept;
+
+    /**
+     * @brief Allocate aligned memory charged to @p tag
+     *
+     * For allocators' backing storage; bypasses the global operator new hook so the
+     * memory is counted once, under the allocator's tag.
+     */
+    [[nodiscard]] static void* Allocate(size_t size, size_t alignment, MemoryTag tag);
+
+    /**
+     * @brief Free memory from Allocate(); size, alignment and tag must match
+     */
+    static void Free(void* ptr, size_t size, size_t alignment, MemoryTag tag) noexcept;
+
+    /**
+     * @brief Get the calling thread's current tag
+     */
+    static MemoryTag GetCurrentTag() noexcept;
+
+    /**
+     * @brief Get statistics for all tags
+     */
+    static MemorySnapshot GetSnapshot();
+
+    /**
+     * @brief Check if the global operator new hook is compiled in
+     */
+    static constexpr bool IsTrackingGlobalHeap() noexcept {
+#ifdef YAMEN_TRACK_MEMORY
+        return true;
+#else
+        return false;
+#endif
+    }
+
+private:
+    friend class ScopedMemoryTag;
+    static MemoryTag SetCurrentTag(MemoryTag tag) noexcept;
+};
+
+/**
+ * @brief Charges allocations on this thread to a tag for the scope's lifetime
+ *
+ * @code
+ * Core::ScopedMemoryTag memoryTag(Core::MemoryTag::Physics);
+ * @endcode
+ */
+class ScopedMemoryTag {
+public:
+    explicit ScopedMemoryTag(MemoryTag tag) noexcept : m_Previous(MemoryTracker::SetCurrentTag(tag)) {}
+    ~ScopedMemoryTag() { MemoryTracker::SetCurrentTag(m_Previous); }
+
+    ScopedMemoryTag(const ScopedMemoryTag&) = delete;
+    ScopedMemoryTag& operator=(const ScopedMemoryTag&) = delete;
+
+private:
+    MemoryTag m_Previous;
+};
+
+} // namespace Yamen::Core
@@ -0,0 +1,216 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Yamen::Core {
+
+/**
+ * @brief Generational handle to an object in an ObjectPool
+ *
+ * Packs a slot index and the slot's generation into one integer. The 32-bit form
+ * uses 20 index bits (about a million live objects) and 12 generation bits; the
+ * 64-bit form uses 32 of each. A value of 0 is never handed out and means "null".
+ *
+ * @tparam Tag Object type, so handles to different pools do not mix
+ * @tparam Storage uint32_t or uint64_t
+ */
+template<typename Tag, typename Storage = uint32_t>
+struct GenerationalHandle {
+    static_assert(std::is_same_v<Storage, uint32_t> || std::is_same_v<Storage, uint64_t>,
+        "GenerationalHandle storage must be uint32_t or uint64_t");
+
+    static constexpr uint32_t IndexBits = sizeof(Storage) == 4 ? 20 : 32;
+    static constexpr uint32_t GenerationBits = sizeof(Storage) * 8 - IndexBits;
+    static constexpr Storage IndexMask = (Storage(1) << IndexBits) - 1;
+    static constexpr Storage GenerationMask = (Storage(1) << GenerationBits) - 1;
+
+    Storage value = 0;
+
+    static constexpr GenerationalHandle Make(Storage index, Storage generation) noexcept {
+        return GenerationalHandle{ (generation << IndexBits) | index };
+    }
+
+    [[nodiscard]] constexpr Storage Index() const noexcept { return value & IndexMask; }
+    [[nodiscard]] constexpr Storage Generation() const noexcept { return value >> IndexBits; }
+    [[nodiscard]] constexpr bool IsNull() const noexcept { return value == 0; }
+
+    constexpr explicit operator bool() const noexcept { return value != 0; }
+    constexpr bool operator==(const GenerationalHandle&) const noexcept = default;
+};
+
+/**
+ * @brief Typed pool that owns its objects and hands out generational handles
+ *
+ * Objects are constructed in place and kept densely packed, so all live objects
+ * can be iterated linearly (begin()/end(), GetObjects()). Destroying an object
+ * moves the last one into its place, so raw pointers and references are only
+ * valid until the next Create/Destroy; handles stay valid until their own object
+ * is destroyed, and a stale handle is detected in O(1) by its generation.
+ *
+ * Not thread-safe; guard externally or keep one pool per thread.
+ *
+ * @code
+ * Core::ObjectPool<ParticleEmitter> emitters;
+ * auto handle = emitters.Create(settings);
+ * if (ParticleEmitter* emitter = emitters.Get(handle)) { ... }
+ * for (ParticleEmitter& emitter : emitters) { emitter.Update(dt); }
+ * emitters.Destroy(handle);
+ * @endcode
+ */
+template<typename T, typename Storage = uint32_t>
+class ObjectPool {
+public:
+    using Handle = GenerationalHandle<T, Storage>;
+
+    explicit ObjectPool(size_t initialCapacity = 64) {
+        Reserve(initialCapacity);
+    }
+
+    // Non-copyable (handles would alias), movable
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+    ObjectPool(ObjectPool&&) noexcept = default;
+    ObjectPool& operator=(ObjectPool&&) noexcept = default;
+
+    /**
+     * @brief Construct an object in the pool
+     * @return Handle to the new object
+     */
+    template<typename... Args>
+    [[nodiscard]] Handle Create(Args&&... args) {
+        if (m_FreeHead == NoSlot) {
+            if (m_Slots.size() > Handle::IndexMask) {
+                throw std::length_error("ObjectPool handle index space exhausted");
+            }
+            m_Slots.push_back(Slot{ NoSlot, 1 });
+            m_FreeHead = static_cast<Storage>(m_Slots.size() - 1);
+        }
+
+        // The slot only leaves the free list once the object exists
+        const Storage index = m_FreeHead;
+        m_DenseToSlot.push_back(index);
+        try {
+            m_Objects.emplace_back(std::forward<Args>(args)...);
+        }
+        catch (...) {
+            m_DenseToSlot.pop_back();
+            throw;
+        }
+
+        Slot& slot = m_Slots[index];
+        m_FreeHead = slot.denseOrNext;
+        slot.denseOrNext = static_cast<Storage>(m_Objects.size() - 1);
+
+        return Handle::Make(index, slot.generation);
+    }
+
+    /**
+     * @brief Destroy the object a handle refers to
+     * @return false if the handle was null or stale
+     */
+    bool Destroy(Handle handle) {
+        if (!IsValid(handle)) {
+            return false;
+        }
+
+        Slot& slot = m_Slots[handle.Index()];
+        const Storage dense = slot.denseOrNext;
+        const Storage last = static_cast<Storage>(m_Objects.size() - 1);
+
+        // Keep storage dense: move the last object into the hole
+        if (dense != last) {
+            m_Objects[dense] = std::move(m_Objects[last]);
+            m_DenseToSlot[dense] = m_DenseToSlot[last];
+            m_Slots[m_DenseToSlot[dense]].denseOrNext = dense;
+        }
+        m_Objects.pop_back();
+        m_DenseToSlot.pop_back();
+
+        // Retire the slot; generation 0 is skipped so no live handle is ever 0
+        slot.generation = (slot.generation + 1) & Handle::GenerationMask;
+        if (slot.generation == 0) {
+            slot.generation = 1;
+        }
+        slot.denseOrNext = m_FreeHead;
+        m_FreeHead = handle.Index();
+        return true;
+    }
+
+    /**
+     * @brief Check if a handle refers to a live object
+     */
+    [[nodiscard]] bool IsValid(Handle handle) const noexcept {
+        const Storage index = handle.Index();
+        return !handle.IsNull() && index < m_Slots.size() && m_Slots[index].generation == handle.Generation()
+            && m_Slots[index].denseOrNext < m_Objects.size() && m_DenseToSlot[m_Slots[index].denseOrNext] == index;
+    }
+
+    /**
+     * @brief Get the object a handle refers to, or nullptr if the handle is stale
+     */
+    [[nodiscard]] T* Get(Handle handle) noexcept {
+        return IsValid(handle) ? &m_Objects[m_Slots[handle.Index()].denseOrNext] : nullptr;
+    }
+
+    [[nodiscard]] const T* Get(Handle handle) const noexcept {
+        return IsValid(handle) ? &m_Objects[m_Slots[handle.Index()].denseOrNext] : nullptr;
+    }
+
+    /**
+     * @brief Get the handle of the object at a position in dense storage
+     */
+    [[nodiscard]] Handle GetHandle(size_t denseIndex) const noexcept {
+        const Storage index = m_DenseToSlot[denseIndex];
+        return Handle::Make(index, m_Slots[index].generation);
+    }
+
+    /**
+     * @brief Destroy all objects; every outstanding handle becomes stale
+     */
+    void Clear() {
+        while (!m_Objects.empty()) {
+            Destroy(GetHandle(m_Objects.size() - 1));
+        }
+    }
+
+    void Reserve(size_t capacity) {
+        m_Objects.reserve(capacity);
+        m_DenseToSlot.reserve(capacity);
+        m_Slots.reserve(capacity);
+    }
+
+    [[nodiscard]] size_t Size() const noexcept { return m_Objects.size(); }
+    [[nodiscard]] bool Empty() const noexcept { return m_Objects.empty(); }
+
+    /**
+     * @brief Live objects in dense order
+     */
+    [[nodiscard]] std::span<T> GetObjects() noexcept { return m_Objects; }
+    [[nodiscard]] std::span<const T> GetObjects() const noexcept { return m_Objects; }
+
+    auto begin() noexcept { return m_Objects.begin(); }
+    auto end() noexcept { return m_Objects.end(); }
+    auto begin() const noexcept { return m_Objects.begin(); }
+    auto end() const noexcept { return m_Objects.end(); }
+
+private:
+    static constexpr Storage NoSlot = ~Storage(0);
+
+    struct Slot {
+        Storage denseOrNext;    // Dense index while live, next free slot while retired
+        Storage generation;
+    };
+
+    std::vector<T> m_Objects;
+    std::vector<Storage> m_DenseToSlot;
+    std::vector<Slot> m_Slots;
+    Storage m_FreeHead = NoSlot;
+};
+
+} // namespace Yamen::Core
@@ -1,36 +1,54 @@
 #pragma once
 
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Memory/ThreadSlots.h"
+#include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
-#include <vector>
+#include <memory>
+#include <mutex>
 
 namespace Yamen::Core {
 
 /**
  * @brief Pool allocator for fixed-size object allocations
- * 
+ *
  * Allocates objects of a fixed size from a pool.
  * Very fast allocation and deallocation.
  * Perfect for frequently allocated/deallocated objects of the same type.
+ *
+ * Memory comes in segments that are never moved or released before the pool is
+ * destroyed, so pointers stay valid while the pool grows. Each thread keeps its
+ * own free list inside the pool and exchanges objects with a shared list in
+ * batches, so Allocate/Free may be called from any thread and an object may be
+ * freed on a different thread than the one that allocated it.
+ *
+ * Debug builds check on Free that the pointer belongs to this pool and is live.
  */
 class PoolAllocator {
 public:
+    static constexpr size_t MaxSegments = 32;        // Segments double in size, so this is never the limit
+    static constexpr size_t MaxThreadCaches = ThreadSlots::MaxSlots;  // Further threads go straight to the shared list
+    static constexpr size_t BatchSize = 32;          // Objects moved between a thread cache and the shared list at once
+    static constexpr size_t MaxCachedObjects = 128;  // Per thread, before a batch is handed back
+
     /**
      * @brief Construct pool allocator
      * @param objectSize Size of each object in bytes
      * @param objectAlignment Alignment requirement
      * @param initialCapacity Initial number of objects
+     * @param tag Memory tag the segments are charged to
      */
-    PoolAllocator(size_t objectSize, size_t objectAlignment, size_t initialCapacity = 64);
+    PoolAllocator(size_t objectSize, size_t objectAlignment, size_t initialCapacity = 64,
+        MemoryTag tag = MemoryTracker::GetCurrentTag());
     ~PoolAllocator();
 
-    // Non-copyable
+    // Non-copyable, non-movable: handed-out pointers and thread caches refer to this pool
     PoolAllocator(const PoolAllocator&) = delete;
     PoolAllocator& operator=(const PoolAllocator&) = delete;
-
-    // Movable
-    PoolAllocator(PoolAllocator&& other) noexcept;
-    PoolAllocator& operator=(PoolAllocator&& other) noexcept;
+    PoolAllocator(PoolAllocator&&) = delete;
+    PoolAllocator& operator=(PoolAllocator&&) = delete;
 
     /**
      * @brief Allocate one object from the pool
@@ -44,34 +62,90 @@ public:
      */
     void Free(void* ptr) noexcept;
 
+    /**
+     * @brief Check if a pointer lies on an object slot of this pool
+     */
+    [[nodiscard]] bool Owns(const void* ptr) const noexcept;
+
+    /**
+     * @brief Return the calling thread's cached objects to the shared list
+     *
+     * Useful before a thread goes idle for a long time; not needed for correctness.
+     */
+    void FlushThreadCache() noexcept;
+
     /**
      * @brief Get object size
      */
     [[nodiscard]] size_t GetObjectSize() const noexcept { return m_ObjectSize; }
 
+    /**
+     * @brief Get object alignment
+     */
+    [[nodiscard]] size_t GetObjectAlignment() const noexcept { return m_ObjectAlignment; }
+
     /**
      * @brief Get number of allocated objects
      */
-    [[nodiscard]] size_t GetAllocatedCount() const noexcept { return m_AllocatedCount; }
+    [[nodiscard]] size_t GetAllocatedCount() const noexcept;
 
     /**
      * @brief Get total capacity
      */
-    [[nodiscard]] size_t GetCapacity() const noexcept { return m_Capacity; }
+    [[nodiscard]] size_t GetCapacity() const noexcept { return m_Capacity.load(std::memory_order_relaxed); }
 
-private:
-    void Grow();
+    /**
+     * @brief Get number of segments obtained from the system
+     */
+    [[nodiscard]] size_t GetSegmentCount() const noexcept { return m_SegmentCount.load(std::memory_order_acquire); }
 
+private:
     struct FreeNode {
         FreeNode* next;
     };
 
-    uint8_t* m_Buffer = nullptr;
-    FreeNode* m_FreeList = nullptr;
+    struct Segment {
+        uint8_t* memory = nullptr;
+        size_t objectCount = 0;
+#ifdef _DEBUG
+        std::unique_ptr<std::atomic<uint8_t>[]> live;   // Per-object allocated flag
+#endif
+    };
+
+    // Only touched by the thread currently holding the matching thread slot
+    struct alignas(64) ThreadCache {
+        FreeNode* head = nullptr;
+        size_t count = 0;
+        std::atomic<int64_t> allocated{ 0 };            // Allocations minus frees through this cache
+    };
+
+    void RefillCache(ThreadCache& cache);
+    void ReturnBatch(ThreadCache& cache, size_t count) noexcept;
+
+    // Requires m_Mutex
+    FreeNode* PopShared();
+    void Grow();
+
+    const Segment* FindSegment(const void* ptr) const noexcept;
+#ifdef _DEBUG
+    bool ValidateFree(void* ptr) const noexcept;
+    void MarkLive(void* ptr, bool live) const noexcept;
+#endif
+
     size_t m_ObjectSize = 0;
     size_t m_ObjectAlignment = 0;
-    size_t m_Capacity = 0;
-    size_t m_AllocatedCount = 0;
+    size_t m_InitialCapacity = 0;
+    MemoryTag m_Tag;
+
+    std::array<Segment, MaxSegments> m_Segments;
+    std::atomic<size_t> m_SegmentCount{ 0 };
+    std::atomic<size_t> m_Capacity{ 0 };
+
+    std::mutex m_Mutex;                                 // Guards the shared list and growth
+    FreeNode* m_FreeList = nullptr;
+    std::atomic<int64_t> m_UncachedAllocated{ 0 };      // Allocations minus frees by threads without a cache
+
+    std::unique_ptr<ThreadCache[]> m_Caches;
 };
 
 } // namespace Yamen::Core
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Yamen::Core {
+
+/**
+ * @brief Thread-caching slab allocator for small, short-lived blocks
+ *
+ * Serves a handful of power-of-two size classes (64 to 512 bytes) from 64 KB
+ * slabs. Each thread keeps its own free list per size class, so allocation and
+ * free are a pointer pop/push in the common case; blocks move to and from a
+ * shared list in batches when a thread cache runs dry or grows too large.
+ * Blocks may be freed on a different thread than the one that allocated them.
+ *
+ * Slabs are never returned to the system, so after warm-up the allocator does
+ * not touch the heap. Requests larger than MaxBlockSize (or over-aligned) fall
+ * through to the global operator new.
+ *
+ * Used for task closures, task queue nodes and future shared state.
+ */
+class SlabAllocator {
+public:
+    static constexpr size_t MinBlockSize = 64;
+    static constexpr size_t MaxBlockSize = 512;
+    static constexpr size_t SizeClassCount = 4;     // 64, 128, 256, 512
+    static constexpr size_t SlabSize = 64 * 1024;
+    static constexpr size_t BlockAlignment = 64;
+
+    struct Stats {
+        size_t slabCount = 0;           // Slabs obtained from the system
+        size_t reservedBytes = 0;       // slabCount * SlabSize
+        size_t oversizedAllocations = 0; // Requests that fell through to operator new
+    };
+
+    /**
+     * @brief Allocate a block of at least @p size bytes
+     * @param alignment Required alignment (blocks are 64-byte aligned)
+     */
+    [[nodiscard]] static void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * @brief Free a block; @p size and @p alignment must match the Allocate call
+     */
+    static void Free(void* ptr, size_t size, size_t alignment = alignof(std::max_align_t)) noexcept;
+
+    /**
+     * @brief Check if a request of this size is served from slabs
+     */
+    static constexpr bool IsPooled(size_t size, size_t alignment = alignof(std::max_align_t)) noexcept {
+        return size <= MaxBlockSize && alignment <= BlockAlignment;
+    }
+
+    /**
+     * @brief Get global statistics
+     */
+    static Stats GetStats() noexcept;
+
+    /**
+     * @brief Construct a T in a slab block
+     */
+    template<typename T, typename... Args>
+    static T* New(Args&&... args) {
+        void* memory = Allocate(sizeof(T), alignof(T));
+        try {
+            return new (memory) T(std::forward<Args>(args)...);
+        }
+        catch (...) {
+            Free(memory, sizeof(T), alignof(T));
+            throw;
+        }
+    }
+
+    /**
+     * @brief Destroy a T created with New()
+     */
+    template<typename T>
+    static void Delete(T* object) noexcept {
+        if (object) {
+            object->~T();
+            Free(object, sizeof(T), alignof(T));
+        }
+    }
+};
+
+/**
+ * @brief Standard allocator adapter over SlabAllocator
+ *
+ * Lets standard library types (e.g. std::promise shared state) draw from the slabs.
+ */
+template<typename T>
+struct SlabStdAllocator {
+    using value_type = T;
+
+    SlabStdAllocator() noexcept = default;
+
+    template<typename U>
+    SlabStdAllocator(const SlabStdAllocator<U>&) noexcept {}
+
+    [[nodiscard]] T* allocate(size_t n) {
+        return static_cast<T*>(SlabAllocator::Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept {
+        SlabAllocator::Free(ptr, n * sizeof(T), alignof(T));
+    }
+
+    template<typename U>
+    bool operator==(const SlabStdAllocator<U>&) const noexcept { return true; }
+
+    template<typename U>
+    bool operator!=(const SlabStdAllocator<U>&) const noexcept { return false; }
+};
+
+} // namespace Yamen::Core
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "Core/Memory/LinearAllocator.h"
+#include "Core/Memory/MemoryTracker.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+namespace Yamen::Core {
+
+/**
+ * @brief Stack allocator for nested temporary allocations
+ *
+ * Like LinearAllocator, allocations bump a pointer through one buffer, but the
+ * top can be saved with GetMarker() and restored with RollbackTo(), releasing
+ * only what was allocated since. Scopes nest: a broad phase can hold scratch
+ * while the narrow phase it calls takes and releases its own. StackScope does
+ * the marker/rollback pair with RAII.
+ *
+ * Each thread has its own stack (ForThread()); a stack is not thread-safe.
+ *
+ * It is also a std::pmr::memory_resource, so scratch containers can live on it.
+ * Requests that do not fit go to the default resource; deallocating the topmost
+ * block pops it, anything else waits for the rollback.
+ *
+ * Release builds store only the offset in a marker. Debug builds put a canary
+ * at every marker and check on rollback that markers are released innermost
+ * first and that nothing wrote over the canary; released memory is filled with
+ * a pattern.
+ */
+class StackAllocator : public std::pmr::memory_resource {
+public:
+    static constexpr size_t DefaultThreadStackSize = 1024 * 1024;
+    static constexpr size_t BufferAlignment = 64;
+
+    /**
+     * @brief Saved stack top
+     */
+    struct Marker {
+        size_t offset = 0;
+#ifdef _DEBUG
+        uint32_t depth = 0;
+#endif
+    };
+
+    /**
+     * @brief Construct stack allocator
+     * @param capacity Size of the stack in bytes
+     * @param tag Memory tag the stack is charged to
+     */
+    explicit StackAllocator(size_t capacity, MemoryTag tag = MemoryTracker::GetCurrentTag());
+    ~StackAllocator() override;
+
+    // Non-copyable, non-movable: outstanding allocations and markers point into the buffer
+    StackAllocator(const StackAllocator&) = delete;
+    StackAllocator& operator=(const StackAllocator&) = delete;
+    StackAllocator(StackAllocator&&) = delete;
+    StackAllocator& operator=(StackAllocator&&) = delete;
+
+    /**
+     * @brief Get the calling thread's stack, created on first use
+     */
+    [[nodiscard]] static StackAllocator& ForThread();
+
+    /**
+     * @brief Allocate memory with alignment
+     * @param size Size in bytes
+     * @param alignment Alignment requirement (must be power of 2)
+     * @return Pointer to allocated memory, or nullptr if out of space
+     */
+    [[nodiscard]] void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t)) noexcept {
+        const uintptr_t base = reinterpret_cast<uintptr_t>(m_Buffer);
+        const size_t alignedOffset = AlignUp(base + m_Offset, alignment) - base;
+        if (alignedOffset + size > m_Capacity) {
+            return nullptr;
+        }
+
+        m_Offset = alignedOffset + size;
+        return m_Buffer + alignedOffset;
+    }
+
+    /**
+     * @brief Save the current top of the stack
+     */
+    [[nodiscard]] Marker GetMarker() noexcept {
+#ifdef _DEBUG
+        return PushCanary();
+#else
+        return { m_Offset };
+#endif
+    }
+
+    /**
+     * @brief Release everything allocated since @p marker was taken
+     *
+     * Markers must be rolled back innermost first.
+     */
+    void RollbackTo(const Marker& marker) noexcept {
+#ifdef _DEBUG
+        PopCanary(marker);
+#else
+        m_Offset = marker.offset;
+#endif
+    }
+
+    /**
+     * @brief Release everything
+     */
+    void Reset() noexcept;
+
+    /**
+     * @brief Check if a pointer lies inside this stack
+     */
+    [[nodiscard]] bool Owns(const void* ptr) const noexcept {
+        const auto* bytes = static_cast<const uint8_t*>(ptr);
+        return bytes >= m_Buffer && bytes < m_Buffer + m_Capacity;
+    }
+
+    [[nodiscard]] size_t GetUsedSize() const noexcept { return m_Offset; }
+    [[nodiscard]] size_t GetCapacity() const noexcept { return m_Capacity; }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+private:
+#ifdef _DEBUG
+    Marker PushCanary() noexcept;
+    void PopCanary(const Marker& marker) noexcept;
+
+    uint32_t m_Depth = 0;
+#endif
+
+    uint8_t* m_Buffer = nullptr;
+    size_t m_Capacity = 0;
+    size_t m_Offset = 0;
+    MemoryTag m_Tag;
+};
+
+/**
+ * @brief Rolls a stack back to where it was when the scope began
+ *
+ * @code
+ * Core::StackScope scratch;
+ * std::pmr::vector<CollisionPair> pairs(scratch.GetResource());
+ * @endcode
+ *
+ * Containers using the scope must be declared after it, so they are destroyed first.
+ */
+class StackScope {
+public:
+    explicit StackScope(StackAllocator& stack = StackAllocator::ForThread()) noexcept
+        : m_Stack(stack), m_Marker(stack.GetMarker()) {
+    }
+    ~StackScope() { m_Stack.RollbackTo(m_Marker); }
+
+    StackScope(const StackScope&) = delete;
+    StackScope& operator=(const StackScope&) = delete;
+
+    [[nodiscard]] StackAllocator& GetAllocator() const noexcept { return m_Stack; }
+    [[nodiscard]] std::pmr::memory_resource* GetResource() const noexcept { return &m_Stack; }
+
+    [[nodiscard]] void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t)) noexcept {
+        return m_Stack.Allocate(size, alignment);
+    }
+
+private:
+    StackAllocator& m_Stack;
+    StackAllocator::Marker m_Marker;
+};
+
+} // namespace Yamen::Core
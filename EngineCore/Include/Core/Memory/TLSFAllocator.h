@@ -0,0 +1,141 @@
+#pragma once
+
+#include "Core/Memory/MemoryTracker.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+
+namespace Yamen::Core {
+
+/**
+ * @brief Two-level segregated fit allocator over a fixed budget
+ *
+ * General-purpose allocator for variable-sized, long-lived blocks that are
+ * churned over time (asset data, chunk payloads). All memory is reserved up
+ * front; Allocate and Free are O(1): free blocks are kept in size-class lists
+ * indexed by two bitmaps, blocks are split on allocation and merged with their
+ * free neighbours on free, so fragmentation stays bounded.
+ *
+ * Allocate returns nullptr once the budget is exhausted; as a
+ * std::pmr::memory_resource it throws std::bad_alloc instead. Thread-safe.
+ *
+ * Debug builds check on Free that the pointer belongs to this allocator and is
+ * not already free.
+ */
+class TLSFAllocator : public std::pmr::memory_resource {
+public:
+    static constexpr size_t Alignment = 16;                     // Of every block and allocation
+    static constexpr size_t BlockOverhead = 16;                 // Header in front of each allocation
+    static constexpr size_t MinBlockSize = 16;                  // Free blocks store their list links in the payload
+    static constexpr size_t MaxBudget = size_t(1) << 32;
+
+    struct Stats {
+        size_t budget = 0;              // Bytes reserved up front
+        size_t usedBytes = 0;           // Allocated payload, including alignment padding
+        size_t peakUsedBytes = 0;
+        size_t freeBytes = 0;           // Payload available in free blocks
+        size_t largestFreeBlock = 0;
+        size_t freeBlockCount = 0;
+        size_t allocationCount = 0;
+
+        /**
+         * @brief Share of free memory not in the largest free block (0 = unfragmented)
+         */
+        [[nodiscard]] float GetFragmentation() const noexcept {
+            return freeBytes ? 1.0f - static_cast<float>(largestFreeBlock) / static_cast<float>(freeBytes) : 0.0f;
+        }
+    };
+
+    /**
+     * @brief Construct TLSF allocator
+     * @param budget Total bytes to reserve
+     * @param tag Memory tag the budget is charged to
+     */
+    explicit TLSFAllocator(size_t budget, MemoryTag tag = MemoryTracker::GetCurrentTag());
+    ~TLSFAllocator() override;
+
+    // Non-copyable, non-movable: handed-out pointers refer to this allocator
+    TLSFAllocator(const TLSFAllocator&) = delete;
+    TLSFAllocator& operator=(const TLSFAllocator&) = delete;
+    TLSFAllocator(TLSFAllocator&&) = delete;
+    TLSFAllocator& operator=(TLSFAllocator&&) = delete;
+
+    /**
+     * @brief Allocate memory with alignment
+     * @param size Size in bytes
+     * @param alignment Alignment requirement (must be power of 2)
+     * @return Pointer to allocated memory, or nullptr if no free block is large enough
+     */
+    [[nodiscard]] void* Allocate(size_t size, size_t alignment = Alignment);
+
+    /**
+     * @brief Return memory from Allocate (null is ignored)
+     */
+    void Free(void* ptr);
+
+    /**
+     * @brief Get the usable size of an allocation (at least the requested size)
+     */
+    [[nodiscard]] static size_t GetAllocationSize(const void* ptr) noexcept;
+
+    /**
+     * @brief Check if a pointer lies inside this allocator's budget
+     */
+    [[nodiscard]] bool Owns(const void* ptr) const noexcept {
+        const auto* bytes = static_cast<const uint8_t*>(ptr);
+        return bytes >= m_Memory && bytes < m_Memory + m_Budget;
+    }
+
+    /**
+     * @brief Get usage and fragmentation statistics (walks all blocks)
+     */
+    [[nodiscard]] Stats GetStats() const;
+
+    [[nodiscard]] size_t GetBudget() const noexcept { return m_Budget; }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t, size_t) override { Free(ptr); }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+private:
+    static constexpr uint32_t SecondLevelLog2 = 5;
+    static constexpr uint32_t SecondLevelCount = 1u << SecondLevelLog2;
+    static constexpr uint32_t FirstLevelShift = SecondLevelLog2 + 4;   // log2(Alignment)
+    static constexpr uint32_t FirstLevelCount = 32 - FirstLevelShift + 1;
+    static constexpr size_t SmallBlockSize = size_t(1) << FirstLevelShift;
+
+    struct BlockHeader;
+
+    struct FreeList {
+        std::array<BlockHeader*, SecondLevelCount> heads{};
+    };
+
+    static void Mapping(size_t size, uint32_t& fl, uint32_t& sl) noexcept;
+    BlockHeader* LocateFree(size_t size);
+    void* PrepareUsed(BlockHeader* block, size_t size);
+    void InsertFree(BlockHeader* block);
+    void RemoveFree(BlockHeader* block);
+    void RemoveFree(BlockHeader* block, uint32_t fl, uint32_t sl);
+    BlockHeader* MergePrevious(BlockHeader* block);
+    BlockHeader* MergeNext(BlockHeader* block);
+    void TrimFree(BlockHeader* block, size_t size);
+    BlockHeader* TrimFreeLeading(BlockHeader* block, size_t size);
+
+    uint8_t* m_Memory = nullptr;
+    size_t m_Budget = 0;
+    MemoryTag m_Tag;
+
+    mutable std::mutex m_Mutex;
+    uint32_t m_FirstLevelMap = 0;
+    std::array<uint32_t, FirstLevelCount> m_SecondLevelMaps{};
+    std::array<FreeList, FirstLevelCount> m_FreeLists{};
+
+    size_t m_UsedBytes = 0;
+    size_t m_PeakUsedBytes = 0;
+    size_t m_AllocationCount = 0;
+};
+
+} // namespace Yamen::Core
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Yamen::Core {
+
+/**
+ * @brief Small, dense per-thread indices for allocator-owned thread caches
+ *
+ * Allocators that keep per-thread state inside the allocator (rather than in
+ * thread_locals that would outlive it) index that state by the calling thread's
+ * slot. A slot is held by one live thread at a time; when the thread exits the
+ * slot, and whatever cached state sits under it, passes to the next thread.
+ */
+class ThreadSlots {
+public:
+    static constexpr uint32_t MaxSlots = 64;
+    static constexpr uint32_t NoSlot = UINT32_MAX;
+
+    /**
+     * @brief Get the calling thread's slot, or NoSlot if all are taken
+     */
+    static uint32_t Current();
+};
+
+} // namespace Yamen::Core
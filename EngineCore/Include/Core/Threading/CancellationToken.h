@@ -0,0 +1,75 @@
+#pragma once
+#include "Core/Memory/SlabAllocator.h"
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+
+namespace Yamen::Core {
+
+    /**
+     * @brief Thrown through a task's future when the task was cancelled before it ran
+     */
+    class TaskCancelledError : public std::runtime_error {
+    public:
+        TaskCancelledError() : std::runtime_error("Task cancelled before it started") {}
+    };
+
+    namespace Detail {
+        struct CancellationState {
+            std::atomic<bool> cancelled{ false };
+        };
+    }
+
+    /**
+     * @brief Read side of a cancellation flag
+     *
+     * Cheap to copy; a default-constructed token can never be cancelled. Tasks poll
+     * IsCancellationRequested() at convenient points and return early.
+     */
+    class CancellationToken {
+    public:
+        CancellationToken() noexcept = default;
+
+        bool IsCancellationRequested() const noexcept {
+            return m_State && m_State->cancelled.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Check if this token is connected to a source (and so may be cancelled)
+         */
+        bool CanBeCancelled() const noexcept { return static_cast<bool>(m_State); }
+
+    private:
+        friend class CancellationSource;
+
+        explicit CancellationToken(std::shared_ptr<Detail::CancellationState> state) noexcept
+            : m_State(std::move(state)) {
+        }
+
+        std::shared_ptr<Detail::CancellationState> m_State;
+    };
+
+    /**
+     * @brief Write side of a cancellation flag; hands out tokens and cancels them
+     *
+     * Cancellation is one-way and idempotent. Copies share the same flag.
+     */
+    class CancellationSource {
+    public:
+        CancellationSource()
+            : m_State(std::allocate_shared<Detail::CancellationState>(SlabStdAllocator<Detail::CancellationState>())) {
+        }
+
+        CancellationToken GetToken() const noexcept { return CancellationToken(m_State); }
+
+        void Cancel() noexcept { m_State->cancelled.store(true, std::memory_order_release); }
+
+        bool IsCancellationRequested() const noexcept {
+            return m_State->cancelled.load(std::memory_order_acquire);
+        }
+
+    private:
+        std::shared_ptr<Detail::CancellationState> m_State;
+    };
+
+} // namespace Yamen::Core
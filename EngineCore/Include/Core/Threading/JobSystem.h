@@ -0,0 +1,148 @@
+#pragma once
+#include "Core/Threading/ThreadPool.h"
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace Yamen::Core {
+
+    struct Job;
+
+    /**
+     * @brief Reference to a job in a JobSystem graph
+     *
+     * Cheap to copy. A default-constructed handle is invalid and counts as completed,
+     * so it can be passed anywhere a dependency is expected.
+     */
+    class JobHandle {
+    public:
+        JobHandle() = default;
+
+        /**
+         * @brief Check if the handle refers to a job
+         */
+        bool IsValid() const noexcept { return m_Job != nullptr; }
+
+        /**
+         * @brief Check if the job has finished running (successfully or not)
+         */
+        bool IsCompleted() const noexcept;
+
+        /**
+         * @brief Check if the job's function threw, or the job was dropped without running
+         *
+         * Jobs are dropped when ThreadPool::ClearPendingTasks() discards their task;
+         * continuations they would have released are dropped with them.
+         */
+        bool HasFailed() const noexcept;
+
+    private:
+        friend class JobSystem;
+        explicit JobHandle(std::shared_ptr<Job> job) : m_Job(std::move(job)) {}
+
+        std::shared_ptr<Job> m_Job;
+    };
+
+    /**
+     * @brief Dependency-driven job graph on top of ThreadPool
+     *
+     * Jobs carry a counter of unfinished prerequisites. When a job finishes it
+     * decrements the counter of each continuation and enqueues the ones that reach
+     * zero, so a chain such as decode -> build -> register never parks a worker in
+     * future::get(). Waiting on a handle runs other pending pool work meanwhile.
+     *
+     * Typical usage:
+     * @code
+     * JobHandle decode = jobs.Schedule([&] { DecodeC3(file); });
+     * JobHandle bones  = jobs.Then(decode, [&] { BuildBoneData(); });
+     * jobs.Wait(bones);
+     * @endcode
+     *
+     * The JobSystem must outlive every job submitted through it.
+     */
+    class JobSystem {
+    public:
+        explicit JobSystem(ThreadPool& threadPool);
+        ~JobSystem();
+
+        // Non-copyable
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        /**
+         * @brief Create a job without submitting it
+         *
+         * Add dependencies with AddDependency(), then call Submit() or SubmitBatch().
+         */
+        JobHandle Create(std::function<void()> work, TaskPriority priority = TaskPriority::Normal);
+
+        /**
+         * @brief Make @p job wait for @p prerequisite
+         *
+         * Must be called before @p job is submitted. Prerequisites that have already
+         * completed (or invalid handles) are ignored.
+         */
+        void AddDependency(const JobHandle& job, const JobHandle& prerequisite);
+
+        /**
+         * @brief Submit a created job; it runs once all its prerequisites complete
+         */
+        void Submit(const JobHandle& job);
+
+        /**
+         * @brief Submit several created jobs, enqueueing the ready ones together
+         */
+        void SubmitBatch(std::span<const JobHandle> jobs);
+
+        /**
+         * @brief Create and submit a job that runs after @p dependencies
+         */
+        JobHandle Schedule(std::function<void()> work,
+            std::span<const JobHandle> dependencies = {},
+            TaskPriority priority = TaskPriority::Normal);
+
+        JobHandle Schedule(std::function<void()> work,
+            std::initializer_list<JobHandle> dependencies,
+            TaskPriority priority = TaskPriority::Normal) {
+            return Schedule(std::move(work), std::span<const JobHandle>(dependencies.begin(), dependencies.size()), priority);
+        }
+
+        /**
+         * @brief Create and submit a continuation of @p prerequisite
+         */
+        JobHandle Then(const JobHandle& prerequisite, std::function<void()> work,
+            TaskPriority priority = TaskPriority::Normal);
+
+        /**
+         * @brief Create and submit an empty job that completes when all @p jobs complete
+         */
+        JobHandle WhenAll(std::span<const JobHandle> jobs);
+
+        /**
+         * @brief Block until @p job completes, running other pending tasks meanwhile
+         */
+        void Wait(const JobHandle& job);
+
+        /**
+         * @brief Block until every job in @p jobs completes
+         */
+        void WaitAll(std::span<const JobHandle> jobs);
+
+        /**
+         * @brief Get underlying thread pool
+         */
+        ThreadPool& GetThreadPool() noexcept { return m_ThreadPool; }
+
+    private:
+        class JobTask;
+
+        void Execute(const std::shared_ptr<Job>& job);
+        void EnqueueReady(std::vector<std::shared_ptr<Job>>& ready);
+        bool ReleaseHold(const std::shared_ptr<Job>& job);
+
+        ThreadPool& m_ThreadPool;
+    };
+
+} // namespace Yamen::Core
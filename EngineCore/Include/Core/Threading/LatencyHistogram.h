@@ -0,0 +1,93 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace Yamen::Core {
+
+    /**
+     * @brief Copy of a LatencyHistogram at one point in time
+     *
+     * Values are in nanoseconds. Snapshots from several histograms can be merged,
+     * e.g. to combine per-worker histograms into a pool-wide one.
+     */
+    struct HistogramSnapshot {
+        static constexpr uint32_t SubBucketBits = 3;                     // 8 sub-buckets per power of two (~12% resolution)
+        static constexpr uint32_t SubBucketCount = 1u << SubBucketBits;
+        static constexpr uint32_t MaxExponent = 40;                       // ~18 minutes; larger values land in the last bucket
+        static constexpr size_t BucketCount = (MaxExponent - SubBucketBits + 1) * SubBucketCount;
+
+        std::array<uint64_t, BucketCount> buckets{};
+        uint64_t count = 0;
+        uint64_t sum = 0;
+        uint64_t max = 0;
+
+        /**
+         * @brief Map a value to its bucket (exact below SubBucketCount, log-linear above)
+         */
+        static constexpr size_t BucketIndex(uint64_t value) noexcept {
+            if (value < SubBucketCount) {
+                return static_cast<size_t>(value);
+            }
+
+            const uint32_t shift = static_cast<uint32_t>(std::bit_width(value)) - 1 - SubBucketBits;
+            const size_t index = (shift + 1) * SubBucketCount + static_cast<size_t>((value >> shift) & (SubBucketCount - 1));
+            return index < BucketCount ? index : BucketCount - 1;
+        }
+
+        /**
+         * @brief Smallest value that maps to a bucket
+         */
+        static constexpr uint64_t BucketLowerBound(size_t index) noexcept {
+            if (index < SubBucketCount) {
+                return index;
+            }
+
+            const uint64_t shift = index / SubBucketCount - 1;
+            return (SubBucketCount + index % SubBucketCount) << shift;
+        }
+
+        /**
+         * @brief Value at or below which @p percentile percent of samples fall (0-100)
+         *
+         * Reported as the upper bound of the bucket that holds the percentile,
+         * capped at the largest recorded value.
+         */
+        uint64_t Percentile(double percentile) const noexcept;
+
+        double Mean() const noexcept { return count ? static_cast<double>(sum) / count : 0.0; }
+
+        void Merge(const HistogramSnapshot& other) noexcept;
+    };
+
+    /**
+     * @brief Lock-free HDR-style latency histogram
+     *
+     * Recording is a few relaxed atomic adds, so it is cheap enough for the task
+     * dispatch path; readers take a HistogramSnapshot at any time without stopping
+     * writers (the snapshot is not atomic as a whole, which is fine for statistics).
+     */
+    class LatencyHistogram {
+    public:
+        void Record(uint64_t nanoseconds) noexcept {
+            m_Buckets[HistogramSnapshot::BucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+            m_Sum.fetch_add(nanoseconds, std::memory_order_relaxed);
+
+            uint64_t max = m_Max.load(std::memory_order_relaxed);
+            while (nanoseconds > max && !m_Max.compare_exchange_weak(max, nanoseconds, std::memory_order_relaxed)) {
+            }
+        }
+
+        HistogramSnapshot Snapshot() const noexcept;
+
+        void Reset() noexcept;
+
+    private:
+        std::array<std::atomic<uint64_t>, HistogramSnapshot::BucketCount> m_Buckets{};
+        std::atomic<uint64_t> m_Sum{ 0 };
+        std::atomic<uint64_t> m_Max{ 0 };
+    };
+
+} // namespace Yamen::Core
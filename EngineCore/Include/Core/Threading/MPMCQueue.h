@@ -0,0 +1,127 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace Yamen::Core {
+
+    /**
+     * @brief Bounded lock-free multi-producer multi-consumer ring
+     *
+     * Dmitry Vyukov's array queue: every cell carries a sequence number that tells
+     * producers and consumers whether it is free for the current lap, so push and
+     * pop are a single CAS on the respective cursor plus one store to the cell.
+     * FIFO for each producer; no allocation after construction.
+     *
+     * @tparam T Default-constructible, nothrow move-assignable element type
+     */
+    template<typename T>
+    class MPMCQueue {
+        static_assert(std::is_nothrow_move_assignable_v<T>, "MPMCQueue requires a nothrow move-assignable type");
+
+    public:
+        /**
+         * @param capacity Ring capacity (rounded up to a power of two)
+         */
+        explicit MPMCQueue(size_t capacity = 1024) {
+            size_t size = 2;
+            while (size < capacity) size <<= 1;
+
+            m_Mask = size - 1;
+            m_Cells = std::make_unique<Cell[]>(size);
+            for (size_t i = 0; i < size; ++i) {
+                m_Cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        // Non-copyable, non-movable
+        MPMCQueue(const MPMCQueue&) = delete;
+        MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+        /**
+         * @brief Push an item (any thread)
+         * @return false if the ring is full; @p item is left untouched in that case
+         */
+        bool TryPush(T&& item) {
+            size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+
+            for (;;) {
+                Cell& cell = m_Cells[pos & m_Mask];
+                const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+                if (diff == 0) {
+                    if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        cell.value = std::move(item);
+                        cell.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0) {
+                    return false;   // Full: the consumer of the previous lap has not caught up
+                }
+                else {
+                    pos = m_EnqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Pop the oldest item (any thread)
+         * @return false if the ring is empty
+         */
+        bool TryPop(T& out) {
+            size_t pos = m_DequeuePos.load(std::memory_order_relaxed);
+
+            for (;;) {
+                Cell& cell = m_Cells[pos & m_Mask];
+                const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+
+                if (diff == 0) {
+                    if (m_DequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        out = std::move(cell.value);
+                        cell.value = T{};   // Release captured state now, not on the next lap
+                        cell.sequence.store(pos + m_Mask + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0) {
+                    return false;   // Empty
+                }
+                else {
+                    pos = m_DequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Approximate number of items (exact only when quiescent)
+         */
+        size_t Size() const noexcept {
+            const size_t enqueued = m_EnqueuePos.load(std::memory_order_relaxed);
+            const size_t dequeued = m_DequeuePos.load(std::memory_order_relaxed);
+            return enqueued > dequeued ? enqueued - dequeued : 0;
+        }
+
+        bool Empty() const noexcept { return Size() == 0; }
+
+        size_t Capacity() const noexcept { return m_Mask + 1; }
+
+    private:
+        struct Cell {
+            std::atomic<size_t> sequence{ 0 };
+            T value{};
+        };
+
+        std::unique_ptr<Cell[]> m_Cells;
+        size_t m_Mask = 0;
+
+        alignas(64) std::atomic<size_t> m_EnqueuePos{ 0 };
+        alignas(64) std::atomic<size_t> m_DequeuePos{ 0 };
+    };
+
+} // namespace Yamen::Core
@@ -0,0 +1,46 @@
+#pragma once
+#include <coroutine>
+#include <cstddef>
+
+namespace Yamen::Core {
+
+    /**
+     * @brief Queue of coroutines to resume on the main thread
+     *
+     * Coroutines that need the main thread (GPU uploads, scene changes) await
+     * NextFrame(); the application calls ProcessFrame() once per frame from its
+     * main loop to resume them. Anything posted while ProcessFrame() runs waits
+     * for the following frame, so a coroutine awaiting NextFrame() in a loop runs
+     * exactly once per frame.
+     */
+    class MainThreadScheduler {
+    public:
+        /**
+         * @brief Queue a coroutine to be resumed by the next ProcessFrame() (any thread)
+         */
+        static void Post(std::coroutine_handle<> handle);
+
+        /**
+         * @brief Resume everything posted before this call (main thread only)
+         * @return Number of coroutines resumed
+         */
+        static size_t ProcessFrame();
+
+        /**
+         * @brief Get number of coroutines waiting for the next frame
+         */
+        static size_t GetPendingCount();
+
+        struct NextFrameAwaiter {
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) { Post(handle); }
+            void await_resume() const noexcept {}
+        };
+
+        /**
+         * @brief co_await NextFrame() to continue on the main thread at the next frame
+         */
+        static NextFrameAwaiter NextFrame() noexcept { return {}; }
+    };
+
+} // namespace Yamen::Core
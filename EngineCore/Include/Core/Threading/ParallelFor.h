@@ -0,0 +1,90 @@
+#pragma once
+#include "Core/Threading/ThreadPool.h"
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace Yamen::Core {
+
+    /**
+     * @brief Half-open index range [begin, end)
+     */
+    struct IndexRange {
+        size_t begin = 0;
+        size_t end = 0;
+
+        size_t Size() const noexcept { return end > begin ? end - begin : 0; }
+        bool Empty() const noexcept { return end <= begin; }
+    };
+
+    /**
+     * @brief Tuning for ParallelFor
+     */
+    struct ParallelForSettings {
+        // With automatic grain sizing, ranges smaller than this run serially on the calling thread
+        static constexpr size_t SerialThreshold = 256;
+
+        // Automatic grain sizing aims for this many chunks per worker (load balancing)
+        static constexpr size_t ChunksPerWorker = 4;
+
+        // Assumed cache line size for chunk alignment
+        static constexpr size_t CacheLineSize = 64;
+    };
+
+    /**
+     * @brief Pick a chunk size for @p count elements of @p elementSize bytes
+     *
+     * Produces roughly ChunksPerWorker chunks per thread, never smaller than one
+     * cache line worth of elements, rounded to whole cache lines so neighbouring
+     * chunks do not write to the same line.
+     */
+    size_t ComputeGrainSize(size_t count, size_t threadCount, size_t elementSize = 0);
+
+    namespace Detail {
+        using ChunkInvoker = void(*)(void* context, size_t begin, size_t end);
+
+        /**
+         * @brief Non-template core of ParallelFor
+         *
+         * Splits the range into chunks that the calling thread and up to one helper task
+         * per worker claim from a shared counter. Returns once every chunk has run;
+         * rethrows the first exception thrown by a chunk.
+         */
+        void ParallelForChunks(ThreadPool& pool, IndexRange range, size_t grainSize,
+            ChunkInvoker invoker, void* context);
+    }
+
+    /**
+     * @brief Run fn(begin, end) over chunks of @p range in parallel
+     * @param grainSize Elements per chunk (0 = automatic)
+     *
+     * The calling thread runs chunks itself until none are left, then yields
+     * until the helpers already inside a chunk loop finish. Helper tasks that
+     * have not started yet are not waited for (they find no chunks left), so
+     * this does not block on a busy pool and may be called from a pool task.
+     */
+    template<typename Fn>
+    void ParallelForChunked(ThreadPool& pool, IndexRange range, size_t grainSize, Fn&& fn) {
+        using FnType = std::remove_reference_t<Fn>;
+
+        Detail::ParallelForChunks(pool, range, grainSize,
+            [](void* context, size_t begin, size_t end) {
+                (*static_cast<FnType*>(context))(begin, end);
+            },
+            const_cast<void*>(static_cast<const void*>(&fn)));
+    }
+
+    /**
+     * @brief Run fn(i) for every index of @p range in parallel
+     * @param grainSize Elements per chunk (0 = automatic)
+     */
+    template<typename Fn>
+    void ParallelFor(ThreadPool& pool, IndexRange range, size_t grainSize, Fn&& fn) {
+        ParallelForChunked(pool, range, grainSize, [&fn](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                fn(i);
+            }
+            });
+    }
+
+} // namespace Yamen::Core
@@ -0,0 +1,313 @@
+#pragma once
+#include "Core/Memory/SlabAllocator.h"
+#include "Core/Threading/ThreadPool.h"
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Yamen::Core {
+
+    template<typename T = void>
+    class Task;
+
+    namespace Detail {
+
+        // Sentinels stored in a promise's continuation word besides a real coroutine address
+        inline char g_TaskDoneTag;
+        inline char g_TaskDetachedTag;
+
+        /**
+         * @brief State shared by every Task promise
+         *
+         * The continuation word is the only synchronisation between the coroutine and
+         * its owner: it holds null (running, nobody waiting), the awaiting coroutine,
+         * the "done" tag (finished, result ready) or the "detached" tag (owner gone,
+         * the frame frees itself when it finishes).
+         */
+        class TaskPromiseBase {
+        public:
+            // Frames come from the slab pool (large frames fall through to operator new)
+            static void* operator new(size_t size) { return SlabAllocator::Allocate(size); }
+            static void operator delete(void* ptr, size_t size) noexcept { SlabAllocator::Free(ptr, size); }
+
+            std::suspend_always initial_suspend() noexcept { return {}; }
+
+            struct FinalAwaiter {
+                bool await_ready() const noexcept { return false; }
+
+                template<typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> self) noexcept {
+                    void* previous = self.promise().m_Continuation.exchange(&g_TaskDoneTag, std::memory_order_acq_rel);
+
+                    if (previous == &g_TaskDetachedTag) {
+                        self.destroy();
+                        return std::noop_coroutine();
+                    }
+
+                    return previous ? std::coroutine_handle<>::from_address(previous) : std::noop_coroutine();
+                }
+
+                void await_resume() const noexcept {}
+            };
+
+            FinalAwaiter final_suspend() noexcept { return {}; }
+
+            void unhandled_exception() noexcept { m_Exception = std::current_exception(); }
+
+            bool IsDone() const noexcept {
+                return m_Continuation.load(std::memory_order_acquire) == &g_TaskDoneTag;
+            }
+
+            /**
+             * @brief Register the coroutine to resume on completion
+             * @return false if the task already finished (the caller must not suspend)
+             */
+            bool TrySetContinuation(std::coroutine_handle<> continuation) noexcept {
+                void* expected = nullptr;
+                return m_Continuation.compare_exchange_strong(expected, continuation.address(),
+                    std::memory_order_acq_rel, std::memory_order_acquire);
+            }
+
+            /**
+             * @brief Give up ownership of a started frame
+             * @return true if the task already finished and the caller must destroy the frame
+             */
+            bool Detach() noexcept {
+                return m_Continuation.exchange(&g_TaskDetachedTag, std::memory_order_acq_rel) == &g_TaskDoneTag;
+            }
+
+        protected:
+            void RethrowIfFailed() const {
+                if (m_Exception) {
+                    std::rethrow_exception(m_Exception);
+                }
+            }
+
+        private:
+            std::atomic<void*> m_Continuation{ nullptr };
+            std::exception_ptr m_Exception;
+        };
+
+        template<typename T>
+        class TaskPromise : public TaskPromiseBase {
+        public:
+            Task<T> get_return_object() noexcept;
+
+            template<typename U>
+            void return_value(U&& value) { m_Value.emplace(std::forward<U>(value)); }
+
+            T& Result() & {
+                RethrowIfFailed();
+                return *m_Value;
+            }
+
+            T Result() && {
+                RethrowIfFailed();
+                return std::move(*m_Value);
+            }
+
+        private:
+            std::optional<T> m_Value;
+        };
+
+        template<>
+        class TaskPromise<void> : public TaskPromiseBase {
+        public:
+            Task<void> get_return_object() noexcept;
+
+            void return_void() noexcept {}
+
+            void Result() const { RethrowIfFailed(); }
+        };
+
+    } // namespace Detail
+
+    /**
+     * @brief Lazily started coroutine producing a T
+     *
+     * A Task does nothing until it is awaited from another coroutine or Start()ed.
+     * Awaiting resumes the awaiter on whichever thread finishes the task, without
+     * blocking any thread in between; combine with ResumeOn() and
+     * MainThreadScheduler::NextFrame() to move between the pool and the main thread.
+     *
+     * Destroying a started, unfinished Task detaches it: the coroutine runs to
+     * completion and frees its own frame, discarding the result.
+     *
+     * @code
+     * Core::Task<Mesh> LoadMesh(Core::ThreadPool& pool, std::filesystem::path path) {
+     *     auto bytes = co_await Core::ReadFileAsync(pool, path);
+     *     MeshData data = ParseMesh(bytes);                  // on a worker
+     *     co_await Core::MainThreadScheduler::NextFrame();
+     *     co_return UploadMesh(data);                        // on the main thread
+     * }
+     * @endcode
+     */
+    template<typename T>
+    class [[nodiscard]] Task {
+    public:
+        using promise_type = Detail::TaskPromise<T>;
+        using Handle = std::coroutine_handle<promise_type>;
+
+        Task() noexcept = default;
+        explicit Task(Handle handle) noexcept : m_Handle(handle) {}
+
+        Task(Task&& other) noexcept
+            : m_Handle(std::exchange(other.m_Handle, nullptr))
+            , m_Started(std::exchange(other.m_Started, false)) {
+        }
+
+        Task& operator=(Task&& other) noexcept {
+            if (this != &other) {
+                Release();
+                m_Handle = std::exchange(other.m_Handle, nullptr);
+                m_Started = std::exchange(other.m_Started, false);
+            }
+            return *this;
+        }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        ~Task() { Release(); }
+
+        /**
+         * @brief Check if this Task owns a coroutine
+         */
+        bool IsValid() const noexcept { return static_cast<bool>(m_Handle); }
+
+        /**
+         * @brief Run the coroutine on the calling thread up to its first suspension
+         *
+         * For starting a task from non-coroutine code; poll IsReady() afterwards.
+         */
+        void Start() {
+            if (!m_Handle || m_Started) {
+                throw std::logic_error("Task started twice or empty");
+            }
+
+            m_Started = true;
+            m_Handle.resume();
+        }
+
+        /**
+         * @brief Check if the coroutine has finished (successfully or not)
+         */
+        bool IsReady() const noexcept {
+            return m_Handle && m_Started && m_Handle.promise().IsDone();
+        }
+
+        /**
+         * @brief Get the result of a finished task; rethrows its exception if it failed
+         */
+        decltype(auto) GetResult() & {
+            if (!IsReady()) {
+                throw std::logic_error("Task result requested before completion");
+            }
+            return m_Handle.promise().Result();
+        }
+
+        decltype(auto) GetResult() && {
+            if (!IsReady()) {
+                throw std::logic_error("Task result requested before completion");
+            }
+            return std::move(m_Handle.promise()).Result();
+        }
+
+        auto operator co_await() & noexcept { return Awaiter<false>{ m_Handle, std::exchange(m_Started, true) }; }
+        auto operator co_await() && noexcept { return Awaiter<true>{ m_Handle, std::exchange(m_Started, true) }; }
+
+    private:
+        template<bool MoveResult>
+        struct Awaiter {
+            Handle handle;
+            bool started;
+
+            bool await_ready() const noexcept { return started && handle.promise().IsDone(); }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                if (!handle.promise().TrySetContinuation(awaiting)) {
+                    return awaiting;    // Finished in the meantime
+                }
+                return started ? std::noop_coroutine() : std::coroutine_handle<>(handle);
+            }
+
+            decltype(auto) await_resume() {
+                if constexpr (MoveResult) {
+                    return std::move(handle.promise()).Result();
+                }
+                else {
+                    return handle.promise().Result();
+                }
+            }
+        };
+
+        void Release() noexcept {
+            if (m_Handle && (!m_Started || m_Handle.promise().Detach())) {
+                m_Handle.destroy();
+            }
+            m_Handle = nullptr;
+        }
+
+        Handle m_Handle = nullptr;
+        bool m_Started = false;
+    };
+
+    namespace Detail {
+
+        template<typename T>
+        Task<T> TaskPromise<T>::get_return_object() noexcept {
+            return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+        }
+
+        inline Task<void> TaskPromise<void>::get_return_object() noexcept {
+            return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+        }
+
+    } // namespace Detail
+
+    /**
+     * @brief Awaitable that continues the coroutine on a ThreadPool worker
+     */
+    class ResumeOnAwaiter {
+    public:
+        ResumeOnAwaiter(ThreadPool& pool, TaskPriority priority) noexcept
+            : m_Pool(pool), m_Priority(priority) {
+        }
+
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle) {
+            m_Pool.EnqueueDetached(m_Priority, [handle] { handle.resume(); });
+        }
+
+        void await_resume() const noexcept {}
+
+    private:
+        ThreadPool& m_Pool;
+        TaskPriority m_Priority;
+    };
+
+    /**
+     * @brief co_await ResumeOn(pool) to hop onto a worker thread
+     */
+    inline ResumeOnAwaiter ResumeOn(ThreadPool& pool, TaskPriority priority = TaskPriority::Normal) noexcept {
+        return ResumeOnAwaiter(pool, priority);
+    }
+
+    /**
+     * @brief Read a whole file on a pool worker
+     *
+     * The awaiting coroutine continues on that worker. Like FileSystem::ReadFile,
+     * the result is empty on error.
+     */
+    Task<std::vector<uint8_t>> ReadFileAsync(ThreadPool& pool, std::filesystem::path path,
+        TaskPriority priority = TaskPriority::Low);
+
+} // namespace Yamen::Core
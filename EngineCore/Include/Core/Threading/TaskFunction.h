@@ -0,0 +1,123 @@
+#pragma once
+#include "Core/Memory/SlabAllocator.h"
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Yamen::Core {
+
+    /**
+     * @brief Move-only void() callable with small-buffer optimisation
+     *
+     * Replacement for std::function<void()> on the task submission path. Callables
+     * up to InlineSize bytes that are nothrow-movable live inside the object; larger
+     * ones go into a SlabAllocator block, so in steady state constructing a task
+     * never touches the general heap. Being move-only, it can own move-only
+     * captures such as a std::promise directly.
+     */
+    class TaskFunction {
+    public:
+        static constexpr size_t InlineSize = 56;
+
+        TaskFunction() noexcept = default;
+        TaskFunction(std::nullptr_t) noexcept {}
+
+        template<typename F,
+            typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, TaskFunction> &&
+                                        std::is_invocable_v<std::decay_t<F>&>>>
+        TaskFunction(F&& f) {
+            using Fn = std::decay_t<F>;
+
+            if constexpr (IsStoredInline<Fn>()) {
+                new (&m_Storage) Fn(std::forward<F>(f));
+                m_VTable = &InlineVTable<Fn>;
+            }
+            else {
+                Fn* object = SlabAllocator::New<Fn>(std::forward<F>(f));
+                new (&m_Storage) Fn*(object);
+                m_VTable = &PooledVTable<Fn>;
+            }
+        }
+
+        TaskFunction(TaskFunction&& other) noexcept {
+            MoveFrom(other);
+        }
+
+        TaskFunction& operator=(TaskFunction&& other) noexcept {
+            if (this != &other) {
+                Reset();
+                MoveFrom(other);
+            }
+            return *this;
+        }
+
+        TaskFunction& operator=(std::nullptr_t) noexcept {
+            Reset();
+            return *this;
+        }
+
+        TaskFunction(const TaskFunction&) = delete;
+        TaskFunction& operator=(const TaskFunction&) = delete;
+
+        ~TaskFunction() { Reset(); }
+
+        void operator()() { m_VTable->invoke(&m_Storage); }
+
+        explicit operator bool() const noexcept { return m_VTable != nullptr; }
+
+        /**
+         * @brief Check if a callable of type F would be stored without any allocation
+         */
+        template<typename F>
+        static constexpr bool IsStoredInline() noexcept {
+            return sizeof(F) <= InlineSize &&
+                alignof(F) <= alignof(std::max_align_t) &&
+                std::is_nothrow_move_constructible_v<F>;
+        }
+
+    private:
+        struct VTable {
+            void (*invoke)(void* storage);
+            void (*move)(void* dst, void* src) noexcept;  // Move-constructs into dst and destroys src
+            void (*destroy)(void* storage) noexcept;
+        };
+
+        template<typename Fn>
+        static constexpr VTable InlineVTable = {
+            [](void* storage) { (*static_cast<Fn*>(storage))(); },
+            [](void* dst, void* src) noexcept {
+                new (dst) Fn(std::move(*static_cast<Fn*>(src)));
+                static_cast<Fn*>(src)->~Fn();
+            },
+            [](void* storage) noexcept { static_cast<Fn*>(storage)->~Fn(); }
+        };
+
+        template<typename Fn>
+        static constexpr VTable PooledVTable = {
+            [](void* storage) { (**static_cast<Fn**>(storage))(); },
+            [](void* dst, void* src) noexcept { new (dst) Fn*(*static_cast<Fn**>(src)); },
+            [](void* storage) noexcept { SlabAllocator::Delete(*static_cast<Fn**>(storage)); }
+        };
+
+        void MoveFrom(TaskFunction& other) noexcept {
+            if (other.m_VTable) {
+                other.m_VTable->move(&m_Storage, &other.m_Storage);
+                m_VTable = other.m_VTable;
+                other.m_VTable = nullptr;
+            }
+        }
+
+        void Reset() noexcept {
+            if (m_VTable) {
+                m_VTable->destroy(&m_Storage);
+                m_VTable = nullptr;
+            }
+        }
+
+        alignas(std::max_align_t) unsigned char m_Storage[InlineSize];
+        const VTable* m_VTable = nullptr;
+    };
+
+} // namespace Yamen::Core
@@ -1,6 +1,13 @@
 #pragma once
+#include "Core/Memory/SlabAllocator.h"
+#include "Core/Threading/CancellationToken.h"
+#include "Core/Threading/LatencyHistogram.h"
+#include "Core/Threading/MPMCQueue.h"
+#include "Core/Threading/TaskFunction.h"
+#include "Core/Threading/WorkStealingDeque.h"
+#include <array>
+#include <deque>
 #include <vector>
-#include <queue>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
@@ -19,12 +26,82 @@ namespace Yamen::Core {
         Critical = 3
     };
 
+    /**
+     * @brief Scheduling options for a single task
+     */
+    struct TaskOptions {
+        TaskPriority priority = TaskPriority::Normal;
+
+        // Checked when a worker picks the task up; cancelled tasks are dropped without running
+        CancellationToken cancellation;
+
+        // Latest time the task may start; a task still queued after this is dropped
+        std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+    };
+
+    namespace Detail {
+
+        /**
+         * @brief Task body for Enqueue: runs the callable into a promise
+         *
+         * If the task is destroyed without running (cancelled, past its deadline or
+         * cleared), the future reports TaskCancelledError instead of a broken promise.
+         */
+        template<typename R, typename Fn>
+        class PromiseTask {
+        public:
+            PromiseTask(std::promise<R>&& promise, Fn&& fn)
+                : m_Promise(std::move(promise)), m_Fn(std::move(fn)) {
+            }
+
+            PromiseTask(PromiseTask&& other) noexcept(std::is_nothrow_move_constructible_v<Fn>)
+                : m_Promise(std::move(other.m_Promise))
+                , m_Fn(std::move(other.m_Fn))
+                , m_Pending(std::exchange(other.m_Pending, false)) {
+            }
+
+            PromiseTask(const PromiseTask&) = delete;
+            PromiseTask& operator=(const PromiseTask&) = delete;
+            PromiseTask& operator=(PromiseTask&&) = delete;
+
+            ~PromiseTask() {
+                if (m_Pending) {
+                    m_Promise.set_exception(std::make_exception_ptr(TaskCancelledError()));
+                }
+            }
+
+            void operator()() {
+                m_Pending = false;
+                try {
+                    if constexpr (std::is_void_v<R>) {
+                        m_Fn();
+                        m_Promise.set_value();
+                    }
+                    else {
+                        m_Promise.set_value(m_Fn());
+                    }
+                }
+                catch (...) {
+                    m_Promise.set_exception(std::current_exception());
+                }
+            }
+
+        private:
+            std::promise<R> m_Promise;
+            Fn m_Fn;
+            bool m_Pending = true;
+        };
+
+    } // namespace Detail
+
     class ThreadPool {
     public:
         struct Stats {
             std::atomic<uint64_t> tasksCompleted{ 0 };
             std::atomic<uint64_t> tasksEnqueued{ 0 };
             std::atomic<uint64_t> tasksFailed{ 0 };
+            std::atomic<uint64_t> tasksStolen{ 0 };
+            std::atomic<uint64_t> tasksCancelled{ 0 };     // Dropped before running (cancelled or past deadline)
             std::atomic<uint32_t> activeThreads{ 0 };
             std::chrono::steady_clock::time_point startTime;
 
@@ -41,10 +118,44 @@ namespace Yamen::Core {
             }
         };
 
+        /**
+         * @brief Counters for one thread that runs tasks
+         */
+        struct WorkerStatsSnapshot {
+            uint64_t tasksExecuted = 0;
+            uint64_t tasksStolen = 0;       // Tasks this thread took from another worker's deque
+            double busySeconds = 0.0;       // Time spent running tasks (nested RunPendingTask work counts twice)
+            double idleSeconds = 0.0;       // Time spent parked with nothing to run
+
+            double GetUtilisation(double uptime) const {
+                return uptime > 0 ? busySeconds / uptime : 0.0;
+            }
+        };
+
+        /**
+         * @brief Point-in-time copy of the per-worker statistics
+         *
+         * Latencies are in nanoseconds, one histogram per TaskPriority, merged over all workers.
+         */
+        struct StatsSnapshot {
+            double uptime = 0.0;
+            std::array<HistogramSnapshot, 4> queueWait;     // Enqueue until a thread starts the task
+            std::array<HistogramSnapshot, 4> runTime;       // Task execution time
+
+            // One entry per worker, plus a last entry for external threads helping via RunPendingTask
+            std::vector<WorkerStatsSnapshot> workers;
+        };
+
         /**
          * @brief Create thread pool with specified number of threads
          * @param numThreads Number of threads (0 = hardware concurrency)
-         * @param enableWorkStealing Enable work stealing optimization
+         * @param enableWorkStealing Give each worker its own Chase-Lev deques. Tasks enqueued
+         *        from a worker go onto that worker's deque; idle workers steal from the others.
+         *        Tasks enqueued from outside the pool still go through the shared queues.
+         *
+         * Shared submissions go into one lock-free ring per priority level. Idle workers
+         * park on an atomic wait (a futex on Linux, WaitOnAddress on Windows) rather
+         * than a mutex-guarded condition variable.
          */
         explicit ThreadPool(size_t numThreads = 0, bool enableWorkStealing = false);
         ~ThreadPool();
@@ -67,32 +178,39 @@ namespace Yamen::Core {
         template<class F, class... Args>
         auto Enqueue(TaskPriority priority, F&& f, Args&&... args)
             -> std::future<typename std::invoke_result<F, Args...>::type> {
+            TaskOptions options;
+            options.priority = priority;
+            return Enqueue(std::move(options), std::forward<F>(f), std::forward<Args>(args)...);
+        }
 
-            using return_type = typename std::invoke_result<F, Args...>::type;
-
-            auto task = std::make_shared<std::packaged_task<return_type()>>(
-                std::bind(std::forward<F>(f), std::forward<Args>(args)...)
-            );
-
-            std::future<return_type> res = task->get_future();
-
-            {
-                std::unique_lock<std::mutex> lock(m_QueueMutex);
+        /**
+         * @brief Enqueue a cancellable task
+         * @param options Priority, cancellation token and start deadline
+         * @return Future for the result; holds TaskCancelledError if the task was dropped
+         *
+         * A task cancelled (or past its deadline) before a worker starts it is dropped
+         * without running. Once running, it can poll IsCurrentTaskCancelled().
+         */
+        template<class F, class... Args>
+        auto Enqueue(TaskOptions options, F&& f, Args&&... args)
+            -> std::future<typename std::invoke_result<F, Args...>::type> {
 
-                if (m_Stop) {
-                    throw std::runtime_error("Enqueue on stopped ThreadPool");
-                }
+            using return_type = typename std::invoke_result<F, Args...>::type;
 
-                m_Tasks.push(TaskWrapper{
-                    priority,
-                    [task]() { (*task)(); },
-                    std::chrono::steady_clock::now()
-                    });
+            // Shared state comes from the slab pool, and the promise is owned by the
+            // task itself, so no packaged_task/shared_ptr/std::function is needed
+            std::promise<return_type> promise(std::allocator_arg, SlabStdAllocator<char>());
+            std::future<return_type> res = promise.get_future();
 
-                m_Stats.tasksEnqueued++;
-            }
+            auto task = BindTask(std::forward<F>(f), std::forward<Args>(args)...);
+            Submit(TaskWrapper{
+                options.priority,
+                Detail::PromiseTask<return_type, decltype(task)>(std::move(promise), std::move(task)),
+                std::chrono::steady_clock::now(),
+                std::move(options.cancellation),
+                options.deadline
+                });
 
-            m_Condition.notify_one();
             return res;
         }
 
@@ -107,27 +225,65 @@ namespace Yamen::Core {
 
         /**
          * @brief Enqueue a fire-and-forget task (no return value)
+         *
+         * Does not allocate in steady state when the callable and its arguments fit
+         * in TaskFunction::InlineSize; larger closures use pooled slab blocks.
          */
         template<class F, class... Args>
         void EnqueueDetached(TaskPriority priority, F&& f, Args&&... args) {
-            {
-                std::unique_lock<std::mutex> lock(m_QueueMutex);
+            Submit(TaskWrapper{
+                priority,
+                BindTask(std::forward<F>(f), std::forward<Args>(args)...),
+                std::chrono::steady_clock::now(),
+                CancellationToken{},
+                std::chrono::steady_clock::time_point::max()
+                });
+        }
 
-                if (m_Stop) {
-                    throw std::runtime_error("Enqueue on stopped ThreadPool");
-                }
+        /**
+         * @brief Enqueue a cancellable fire-and-forget task
+         */
+        template<class F, class... Args>
+        void EnqueueDetached(TaskOptions options, F&& f, Args&&... args) {
+            Submit(TaskWrapper{
+                options.priority,
+                BindTask(std::forward<F>(f), std::forward<Args>(args)...),
+                std::chrono::steady_clock::now(),
+                std::move(options.cancellation),
+                options.deadline
+                });
+        }
 
-                m_Tasks.push(TaskWrapper{
-                    priority,
-                    std::bind(std::forward<F>(f), std::forward<Args>(args)...),
-                    std::chrono::steady_clock::now()
-                    });
+        /**
+         * @brief Check if the task running on the calling thread has been cancelled
+         *
+         * Lets long-running task bodies exit early without threading a token through
+         * their signature. False outside a pool task or for tasks without a token.
+         */
+        static bool IsCurrentTaskCancelled();
 
-                m_Stats.tasksEnqueued++;
-            }
+        /**
+         * @brief Enqueue several fire-and-forget tasks at once
+         *
+         * From outside the pool the tasks go into the shared ring for @p priority and
+         * wake as many workers as needed; from a worker in work-stealing mode they go
+         * onto its local deque.
+         */
+        void EnqueueBatchDetached(TaskPriority priority, std::vector<TaskFunction>& tasks);
 
-            m_Condition.notify_one();
-        }
+        /**
+         * @brief Run one pending task on the calling thread, if any is available
+         *
+         * Lets a thread that is waiting on other work help instead of blocking.
+         * Callable from workers and from external threads.
+         * @return true if a task was executed
+         */
+        bool RunPendingTask();
+
+        /**
+         * @brief Check if the calling thread is one of this pool's workers
+         */
+        bool IsWorkerThread() const;
 
         /**
          * @brief Wait for all tasks to complete
@@ -136,7 +292,7 @@ namespace Yamen::Core {
         bool WaitForAll(std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
 
         /**
-         * @brief Get number of pending tasks
+         * @brief Get number of pending tasks (queued but not yet started)
          */
         size_t GetPendingTaskCount() const;
 
@@ -150,6 +306,19 @@ namespace Yamen::Core {
          */
         const Stats& GetStats() const { return m_Stats; }
 
+        /**
+         * @brief Collect latency histograms and per-worker utilisation
+         *
+         * Workers record into their own lock-free counters; this only reads them,
+         * so it is safe to call every frame from a debug overlay.
+         */
+        StatsSnapshot GetStatsSnapshot() const;
+
+        /**
+         * @brief Zero the per-worker counters and histograms (e.g. to measure one level load)
+         */
+        void ResetStatsSnapshot();
+
         /**
          * @brief Clear all pending tasks (does not cancel running tasks)
          */
@@ -170,31 +339,106 @@ namespace Yamen::Core {
          */
         bool IsPaused() const { return m_Paused.load(); }
 
+        /**
+         * @brief Check if work stealing is enabled
+         */
+        bool IsWorkStealingEnabled() const { return m_EnableWorkStealing; }
+
     private:
+        /**
+         * @brief Bind arguments into a closure without std::bind/std::function
+         */
+        template<class F, class... Args>
+        static auto BindTask(F&& f, Args&&... args) {
+            return [f = std::forward<F>(f), ... args = std::forward<Args>(args)]() mutable -> decltype(auto) {
+                return std::invoke(f, args...);
+            };
+        }
+
         struct TaskWrapper {
-            TaskPriority priority;
-            std::function<void()> task;
+            TaskPriority priority = TaskPriority::Normal;
+            TaskFunction task;
             std::chrono::steady_clock::time_point enqueueTime;
+            CancellationToken cancellation;
+            std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+        };
 
-            bool operator<(const TaskWrapper& other) const {
-                // Higher priority = lower value in priority_queue (reverse)
-                return priority < other.priority;
-            }
+        static constexpr size_t PriorityCount = 4;
+
+        // Slots per shared ring; submissions beyond this spill into a locked overflow list,
+        // which then takes every submission until consumers have drained it
+        static constexpr size_t SharedQueueCapacity = 1024;
+
+        // Every Nth pick on a thread serves a lower priority level first (rotating
+        // Low, Normal, High), so Low work still progresses while Critical work saturates the pool
+        static constexpr uint32_t StarvationInterval = 8;
+
+        // Failed pick attempts before an idle worker parks
+        static constexpr int SpinCount = 32;
+
+        /**
+         * @brief Shared queue for one priority level
+         */
+        struct SharedQueue {
+            MPMCQueue<TaskWrapper> ring{ SharedQueueCapacity };
+            std::deque<TaskWrapper> overflow;               // Guarded by m_OverflowMutex
+            std::atomic<size_t> overflowCount{ 0 };
         };
 
+        /**
+         * @brief Per-worker deques, one per priority level (work stealing mode only)
+         */
+        struct WorkerQueues {
+            std::array<WorkStealingDeque<TaskWrapper*>, PriorityCount> deques;
+        };
+
+        /**
+         * @brief Statistics written by one thread (workers) or shared by external helpers
+         */
+        struct alignas(64) WorkerStats {
+            std::array<LatencyHistogram, PriorityCount> queueWait;
+            std::array<LatencyHistogram, PriorityCount> runTime;
+            std::atomic<uint64_t> tasksExecuted{ 0 };
+            std::atomic<uint64_t> tasksStolen{ 0 };
+            std::atomic<uint64_t> busyNanoseconds{ 0 };
+            std::atomic<uint64_t> idleNanoseconds{ 0 };
+            std::atomic<int64_t> parkedSince{ 0 };    // steady_clock ticks while parked, 0 otherwise
+        };
+
+        void Submit(TaskWrapper&& task);
+        void PushShared(TaskWrapper&& task);
+        void WakeWorkers(size_t count);
+
         void WorkerThread(size_t threadId);
+        void WorkerLoop(size_t threadId);
+        void Park(size_t threadId);
+        void ExecuteTask(size_t threadId, TaskWrapper& taskWrapper);
+
+        bool TryPopTask(size_t threadId, TaskWrapper& out);
+        bool TryPopLevel(size_t threadId, size_t level, TaskWrapper& out);
+        bool TryPopShared(size_t level, TaskWrapper& out);
+        bool TrySteal(size_t thiefId, size_t priority, TaskWrapper& out);
+
         void SetThreadName(const std::string& name);
 
         std::vector<std::thread> m_Workers;
-        std::priority_queue<TaskWrapper> m_Tasks;
+        std::vector<std::unique_ptr<WorkerQueues>> m_WorkerQueues;
+        std::vector<std::unique_ptr<WorkerStats>> m_WorkerStats;   // Workers + one external slot
+        std::array<SharedQueue, PriorityCount> m_SharedQueues;
 
-        mutable std::mutex m_QueueMutex;
-        std::condition_variable m_Condition;
+        std::mutex m_OverflowMutex;
+        mutable std::mutex m_WaitMutex;                 // Only for WaitForAll
         std::condition_variable m_WaitCondition;
 
+        // Parking word: idle workers wait on it, producers bump it to wake them
+        std::atomic<uint32_t> m_WakeEpoch{ 0 };
+
         std::atomic<bool> m_Stop{ false };
         std::atomic<bool> m_Paused{ false };
         std::atomic<size_t> m_ActiveTasks{ 0 };
+        std::atomic<size_t> m_PendingTasks{ 0 };      // Queued anywhere (shared queues + deques)
+        std::atomic<size_t> m_SleepingWorkers{ 0 };
+        std::atomic<size_t> m_WaitingThreads{ 0 };
 
         bool m_EnableWorkStealing;
         Stats m_Stats;
@@ -0,0 +1,160 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Yamen::Core {
+
+    /**
+     * @brief Chase-Lev work-stealing deque
+     *
+     * Single-owner, multi-thief deque (Chase & Lev 2005, with the C11 memory
+     * orderings from Le et al. 2013). The owning worker pushes and pops at the
+     * bottom without contention; other workers steal from the top with a single CAS.
+     *
+     * Retired buffers are kept alive until the deque is destroyed, since a thief may
+     * still be reading from a buffer the owner has just replaced.
+     *
+     * @tparam T Trivially copyable element type (typically a pointer)
+     */
+    template<typename T>
+    class WorkStealingDeque {
+        static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque requires a trivially copyable type");
+
+    public:
+        /**
+         * @param initialCapacity Initial ring capacity (rounded up to a power of two)
+         */
+        explicit WorkStealingDeque(size_t initialCapacity = 256) {
+            size_t capacity = 1;
+            while (capacity < initialCapacity) capacity <<= 1;
+
+            auto buffer = std::make_unique<Buffer>(static_cast<int64_t>(capacity));
+            m_Buffer.store(buffer.get(), std::memory_order_relaxed);
+            m_Buffers.push_back(std::move(buffer));
+        }
+
+        // Non-copyable, non-movable
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        /**
+         * @brief Push an item at the bottom (owner thread only)
+         */
+        void Push(T item) {
+            int64_t b = m_Bottom.load(std::memory_order_relaxed);
+            int64_t t = m_Top.load(std::memory_order_acquire);
+            Buffer* buffer = m_Buffer.load(std::memory_order_relaxed);
+
+            if (b - t > buffer->capacity - 1) {
+                buffer = Grow(buffer, b, t);
+            }
+
+            buffer->Put(b, item);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_Bottom.store(b + 1, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Pop the most recently pushed item (owner thread only)
+         * @return true if an item was popped
+         */
+        bool Pop(T& out) {
+            int64_t b = m_Bottom.load(std::memory_order_relaxed) - 1;
+            Buffer* buffer = m_Buffer.load(std::memory_order_relaxed);
+            m_Bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t t = m_Top.load(std::memory_order_relaxed);
+
+            if (t > b) {
+                // Empty
+                m_Bottom.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            out = buffer->Get(b);
+
+            if (t == b) {
+                // Last item: race against thieves for it
+                bool won = m_Top.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed);
+                m_Bottom.store(b + 1, std::memory_order_relaxed);
+                return won;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Steal the oldest item (any thread)
+         * @return true if an item was stolen; false if empty or another thread won the race
+         */
+        bool Steal(T& out) {
+            int64_t t = m_Top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t b = m_Bottom.load(std::memory_order_acquire);
+
+            if (t >= b) {
+                return false;
+            }
+
+            Buffer* buffer = m_Buffer.load(std::memory_order_acquire);
+            T item = buffer->Get(t);
+
+            if (!m_Top.compare_exchange_strong(t, t + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return false;
+            }
+
+            out = item;
+            return true;
+        }
+
+        /**
+         * @brief Approximate number of items (exact only when quiescent)
+         */
+        size_t Size() const noexcept {
+            int64_t b = m_Bottom.load(std::memory_order_relaxed);
+            int64_t t = m_Top.load(std::memory_order_relaxed);
+            return b > t ? static_cast<size_t>(b - t) : 0;
+        }
+
+        bool Empty() const noexcept { return Size() == 0; }
+
+    private:
+        struct Buffer {
+            int64_t capacity;
+            int64_t mask;
+            std::unique_ptr<std::atomic<T>[]> data;
+
+            explicit Buffer(int64_t cap)
+                : capacity(cap), mask(cap - 1), data(new std::atomic<T>[static_cast<size_t>(cap)]) {}
+
+            T Get(int64_t i) const noexcept { return data[i & mask].load(std::memory_order_relaxed); }
+            void Put(int64_t i, T item) noexcept { data[i & mask].store(item, std::memory_order_relaxed); }
+        };
+
+        Buffer* Grow(Buffer* old, int64_t b, int64_t t) {
+            auto buffer = std::make_unique<Buffer>(old->capacity * 2);
+            for (int64_t i = t; i < b; ++i) {
+                buffer->Put(i, old->Get(i));
+            }
+
+            Buffer* raw = buffer.get();
+            m_Buffers.push_back(std::move(buffer));
+            m_Buffer.store(raw, std::memory_order_release);
+            return raw;
+        }
+
+        alignas(64) std::atomic<int64_t> m_Top{ 0 };
+        alignas(64) std::atomic<int64_t> m_Bottom{ 0 };
+        alignas(64) std::atomic<Buffer*> m_Buffer{ nullptr };
+
+        // Owner-only: every buffer ever allocated, released on destruction
+        std::vector<std::unique_ptr<Buffer>> m_Buffers;
+    };
+
+} // namespace Yamen::Core
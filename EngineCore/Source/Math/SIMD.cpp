@@ -0,0 +1,158 @@
+#include "Core/Math/SIMD.h"
+#include <algorithm>
+#include <cstring>
+
+namespace Yamen {
+namespace Core {
+namespace simd {
+
+namespace {
+
+constexpr size_t Width = Vec3x8::Lanes;
+
+// Run kernel(in, out, first) over full groups of eight in place, then once
+// more on a zero-padded copy of the tail so every element goes through the
+// same math.
+template <typename Kernel>
+void ForEachBatch(const float *in, float *out, size_t count, Kernel &&kernel) {
+  const size_t full = count - count % Width;
+
+  for (size_t i = 0; i < full; i += Width) {
+    kernel(Vec3x8::LoadAoS(in + i * 3), out + i * 3, i);
+  }
+
+  if (const size_t tail = count - full) {
+    float padded[Width * 3] = {};
+    float result[Width * 3];
+    std::memcpy(padded, in + full * 3, tail * 3 * sizeof(float));
+    kernel(Vec3x8::LoadAoS(padded), result, full);
+    std::memcpy(out + full * 3, result, tail * 3 * sizeof(float));
+  }
+}
+
+// Eight elements of Components floats from first; lanes past the end of the
+// input are zero-filled
+template <size_t Components>
+const float *PadTail(const float *in, size_t count, size_t first,
+                     float (&padded)[Width * Components]) {
+  if (first + Width <= count) {
+    return in + first * Components;
+  }
+  std::fill_n(padded, Width * Components, 0.0f);
+  std::memcpy(padded, in + first * Components,
+              (count - first) * Components * sizeof(float));
+  return padded;
+}
+
+} // namespace
+
+void TransformPoints(const float *m, const float *points, float *out,
+                     size_t count) {
+  ForEachBatch(points, out, count, [m](const Vec3x8 &p, float *dst, size_t) {
+    TransformPoint(m, p).StoreAoS(dst);
+  });
+}
+
+void TransformVectors(const float *m, const float *vectors, float *out,
+                      size_t count) {
+  ForEachBatch(vectors, out, count, [m](const Vec3x8 &v, float *dst, size_t) {
+    TransformVector(m, v).StoreAoS(dst);
+  });
+}
+
+void Dot(const float *a, const float *b, float *out, size_t count) {
+  for (size_t i = 0; i < count; i += Width) {
+    float paddedA[Width * 3], paddedB[Width * 3];
+    const Float8 dots =
+        Dot(Vec3x8::LoadAoS(PadTail<3>(a, count, i, paddedA)),
+            Vec3x8::LoadAoS(PadTail<3>(b, count, i, paddedB)));
+
+    if (i + Width <= count) {
+      dots.Store(out + i);
+    } else {
+      float result[Width];
+      dots.Store(result);
+      std::memcpy(out + i, result, (count - i) * sizeof(float));
+    }
+  }
+}
+
+void Cross(const float *a, const float *b, float *out, size_t count) {
+  ForEachBatch(a, out, count,
+               [b, count](const Vec3x8 &va, float *dst, size_t first) {
+                 float padded[Width * 3];
+                 Cross(va, Vec3x8::LoadAoS(PadTail<3>(b, count, first, padded)))
+                     .StoreAoS(dst);
+               });
+}
+
+void Normalize(const float *v, float *out, size_t count) {
+  ForEachBatch(v, out, count, [](const Vec3x8 &x, float *dst, size_t) {
+    simd::Normalize(x).StoreAoS(dst);
+  });
+}
+
+void RotateAll(const float *q, const float *v, float *out, size_t count) {
+  const Quatx8 rotation = Quatx8::Broadcast(q);
+  ForEachBatch(v, out, count, [&rotation](const Vec3x8 &x, float *dst, size_t) {
+    simd::Rotate(rotation, x).StoreAoS(dst);
+  });
+}
+
+void Rotate(const float *q, const float *v, float *out, size_t count) {
+  ForEachBatch(v, out, count,
+               [q, count](const Vec3x8 &x, float *dst, size_t first) {
+                 float padded[Width * 4];
+                 simd::Rotate(Quatx8::LoadAoS(PadTail<4>(q, count, first, padded)),
+                              x)
+                     .StoreAoS(dst);
+               });
+}
+
+void ComposeTransforms(const float *translations, const float *rotations,
+                       const float *scales, float *out, size_t count) {
+  const Float8 one = Float8::Broadcast(1.0f);
+  const Float8 two = Float8::Broadcast(2.0f);
+  const Float8 zero = Float8::Broadcast(0.0f);
+
+  for (size_t first = 0; first < count; first += Width) {
+    float paddedT[Width * 3], paddedS[Width * 3], paddedR[Width * 4];
+    const Vec3x8 t =
+        Vec3x8::LoadAoS(PadTail<3>(translations, count, first, paddedT));
+    const Quatx8 q =
+        Quatx8::LoadAoS(PadTail<4>(rotations, count, first, paddedR));
+    const Vec3x8 s = Vec3x8::LoadAoS(PadTail<3>(scales, count, first, paddedS));
+
+    // Rotation rows as in XMMatrixRotationQuaternion
+    const Float8 xx = q.x * q.x * two, yy = q.y * q.y * two,
+                 zz = q.z * q.z * two;
+    const Float8 xy = q.x * q.y * two, xz = q.x * q.z * two,
+                 yz = q.y * q.z * two;
+    const Float8 wx = q.w * q.x * two, wy = q.w * q.y * two,
+                 wz = q.w * q.z * two;
+
+    const Vec3x8 r0{one - yy - zz, xy + wz, xz - wy};
+    const Vec3x8 r1{xy - wz, one - xx - zz, yz + wx};
+    const Vec3x8 r2{xz + wy, yz - wx, one - xx - yy};
+
+    // T * R puts t * R in the last row; S then scales every column
+    const Vec3x8 rows[4] = {r0 * s, r1 * s, r2 * s,
+                            (r0 * t.x + r1 * t.y + r2 * t.z) * s};
+    const Float8 w[4] = {zero, zero, zero, one};
+
+    // Transpose each row of eight matrices into packed float4s, then scatter
+    const size_t lanes = std::min(Width, count - first);
+    for (int row = 0; row < 4; ++row) {
+      float packed[Width * 4];
+      StoreXYZW(packed, rows[row].x, rows[row].y, rows[row].z, w[row]);
+      for (size_t k = 0; k < lanes; ++k) {
+        std::memcpy(out + (first + k) * 16 + row * 4, &packed[k * 4],
+                    4 * sizeof(float));
+      }
+    }
+  }
+}
+
+} // namespace simd
+} // namespace Core
+} // namespace Yamen
@@ -0,0 +1,121 @@
+#include "Core/Memory/FrameAllocator.h"
+#include "Core/Memory/ThreadSlots.h"
+#include "Core/Logging/Logger.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace Yamen::Core {
+
+FrameAllocator::FrameAllocator(size_t capacity, uint32_t framesInFlight, MemoryTag tag)
+    : m_FramesInFlight(framesInFlight)
+    , m_Capacity(AlignUp(std::max(capacity, SubArenaSize), SubArenaSize))
+    , m_Tag(tag) {
+
+    if (framesInFlight < 2 || framesInFlight > MaxFramesInFlight) {
+        throw std::invalid_argument("FrameAllocator needs 2 or 3 frames in flight");
+    }
+
+    for (uint32_t i = 0; i < m_FramesInFlight; ++i) {
+        m_Frames[i].subArenas = std::make_unique<SubArena[]>(ThreadSlots::MaxSlots);
+        ResetBuffer(m_Frames[i]);
+    }
+}
+
+FrameAllocator::~FrameAllocator() {
+    for (uint32_t i = 0; i < m_FramesInFlight; ++i) {
+        ReleaseOverflow(m_Frames[i]);
+        MemoryTracker::Free(m_Frames[i].memory, m_Frames[i].capacity, BufferAlignment, m_Tag);
+        m_Frames[i].memory = nullptr;
+    }
+}
+
+void FrameAllocator::BeginFrame() {
+    // Record how much the finished frame needed; buffers grow to it as they come round
+    const size_t used = GetUsedSize();
+    m_HighWaterMark = std::max(m_HighWaterMark, used);
+
+    if (m_HighWaterMark > m_Capacity) {
+        m_Capacity = AlignUp(m_HighWaterMark + m_HighWaterMark / 4, SubArenaSize);
+        YAMEN_CORE_INFO("FrameAllocator growing to {} KB per frame", m_Capacity / 1024);
+    }
+
+    m_CurrentFrame = (m_CurrentFrame + 1) % m_FramesInFlight;
+    ++m_FrameNumber;
+
+    ResetBuffer(m_Frames[m_CurrentFrame]);
+}
+
+void* FrameAllocator::Allocate(size_t size, size_t alignment) {
+    size = std::max<size_t>(size, 1);
+    FrameBuffer& frame = m_Frames[m_CurrentFrame];
+
+    const uint32_t slot = ThreadSlots::Current();
+    if (size > MaxSubArenaAllocation || alignment > BufferAlignment || slot == ThreadSlots::NoSlot) {
+        return AllocateShared(frame, size, alignment);
+    }
+
+    LinearAllocator& arena = frame.subArenas[slot].arena;
+    if (void* ptr = arena.Allocate(size, alignment)) {
+        return ptr;
+    }
+
+    // Sub-arena exhausted: claim the next chunk of the frame buffer
+    arena = LinearAllocator(AllocateShared(frame, SubArenaSize, BufferAlignment), SubArenaSize);
+    return arena.Allocate(size, alignment);
+}
+
+size_t FrameAllocator::GetUsedSize() const noexcept {
+    const FrameBuffer& frame = m_Frames[m_CurrentFrame];
+    return frame.offset.load(std::memory_order_relaxed) + frame.overflowBytes.load(std::memory_order_relaxed);
+}
+
+void* FrameAllocator::AllocateShared(FrameBuffer& frame, size_t size, size_t alignment) {
+    const uintptr_t base = reinterpret_cast<uintptr_t>(frame.memory);
+
+    size_t offset = frame.offset.load(std::memory_order_relaxed);
+    for (;;) {
+        const size_t alignedOffset = AlignUp(base + offset, alignment) - base;
+        if (alignedOffset + size > frame.capacity) {
+            break;
+        }
+        if (frame.offset.compare_exchange_weak(offset, alignedOffset + size, std::memory_order_relaxed)) {
+            return frame.memory + alignedOffset;
+        }
+    }
+
+    // Out of space this frame: take it from the heap until the buffer is recycled
+    alignment = std::max(alignment, static_cast<size_t>(__STDCPP_DEFAULT_NEW_ALIGNMENT__));
+    void* ptr = MemoryTracker::Allocate(size, alignment, m_Tag);
+
+    std::lock_guard<std::mutex> lock(frame.overflowMutex);
+    frame.overflow.push_back({ ptr, size, alignment });
+    frame.overflowBytes.fetch_add(size, std::memory_order_relaxed);
+    return ptr;
+}
+
+void FrameAllocator::ResetBuffer(FrameBuffer& frame) {
+    ReleaseOverflow(frame);
+
+    if (frame.capacity != m_Capacity) {
+        MemoryTracker::Free(frame.memory, frame.capacity, BufferAlignment, m_Tag);
+        frame.memory = nullptr;
+        frame.capacity = 0;
+        frame.memory = static_cast<uint8_t*>(MemoryTracker::Allocate(m_Capacity, BufferAlignment, m_Tag));
+        frame.capacity = m_Capacity;
+    }
+
+    frame.offset.store(0, std::memory_order_relaxed);
+    for (uint32_t i = 0; i < ThreadSlots::MaxSlots; ++i) {
+        frame.subArenas[i].arena = LinearAllocator();
+    }
+}
+
+void FrameAllocator::ReleaseOverflow(FrameBuffer& frame) noexcept {
+    for (const OverflowBlock& block : frame.overflow) {
+        MemoryTracker::Free(block.memory, block.size, block.alignment, m_Tag);
+    }
+    frame.overflow.clear();
+    frame.overflowBytes.store(0, std::memory_order_relaxed);
+}
+
+} // namespace Yamen::Core
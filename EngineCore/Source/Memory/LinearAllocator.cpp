@@ -5,44 +5,62 @@
 
 namespace Yamen::Core {
 
-LinearAllocator::LinearAllocator(size_t capacity)
+LinearAllocator::LinearAllocator(size_t capacity, MemoryTag tag)
     : m_Capacity(capacity)
-    , m_Offset(0) {
+    , m_Offset(0)
+    , m_OwnsBuffer(true)
+    , m_Tag(tag) {
     m_Buffer = static_cast<uint8_t*>(std::malloc(capacity));
     if (!m_Buffer) {
         throw std::bad_alloc();
     }
+    MemoryTracker::RecordAllocation(m_Tag, m_Capacity);
+}
+
+LinearAllocator::LinearAllocator(void* buffer, size_t capacity) noexcept
+    : m_Buffer(static_cast<uint8_t*>(buffer))
+    , m_Capacity(capacity)
+    , m_Offset(0)
+    , m_OwnsBuffer(false) {
 }
 
 LinearAllocator::~LinearAllocator() {
-    if (m_Buffer) {
+    if (m_Buffer && m_OwnsBuffer) {
         std::free(m_Buffer);
-        m_Buffer = nullptr;
+        MemoryTracker::RecordFree(m_Tag, m_Capacity);
     }
+    m_Buffer = nullptr;
 }
 
 LinearAllocator::LinearAllocator(LinearAllocator&& other) noexcept
     : m_Buffer(other.m_Buffer)
     , m_Capacity(other.m_Capacity)
-    , m_Offset(other.m_Offset) {
+    , m_Offset(other.m_Offset)
+    , m_OwnsBuffer(other.m_OwnsBuffer)
+    , m_Tag(other.m_Tag) {
     other.m_Buffer = nullptr;
     other.m_Capacity = 0;
     other.m_Offset = 0;
+    other.m_OwnsBuffer = false;
 }
 
 LinearAllocator& LinearAllocator::operator=(LinearAllocator&& other) noexcept {
     if (this != &other) {
-        if (m_Buffer) {
+        if (m_Buffer && m_OwnsBuffer) {
             std::free(m_Buffer);
+            MemoryTracker::RecordFree(m_Tag, m_Capacity);
         }
         
         m_Buffer = other.m_Buffer;
         m_Capacity = other.m_Capacity;
         m_Offset = other.m_Offset;
+        m_OwnsBuffer = other.m_OwnsBuffer;
+        m_Tag = other.m_Tag;
         
         other.m_Buffer = nullptr;
         other.m_Capacity = 0;
         other.m_Offset = 0;
+        other.m_OwnsBuffer = false;
     }
     return *this;
 }
@@ -52,8 +70,9 @@ void* LinearAllocator::Allocate(size_t size, size_t alignment) {
         return nullptr;
     }
     
-    // Align current offset
-    const size_t alignedOffset = AlignUp(m_Offset, alignment);
+    // Align the address rather than the offset, so alignments beyond the buffer's own work
+    const uintptr_t base = reinterpret_cast<uintptr_t>(m_Buffer);
+    const size_t alignedOffset = AlignUp(base + m_Offset, alignment) - base;
     
     // Check if we have enough space
     if (alignedOffset + size > m_Capacity) {
@@ -72,7 +91,8 @@ void LinearAllocator::Reset() noexcept {
 }
 
 bool LinearAllocator::CanAllocate(size_t size, size_t alignment) const noexcept {
-    const size_t alignedOffset = AlignUp(m_Offset, alignment);
+    const uintptr_t base = reinterpret_cast<uintptr_t>(m_Buffer);
+    const size_t alignedOffset = AlignUp(base + m_Offset, alignment) - base;
     return alignedOffset + size <= m_Capacity;
 }
 
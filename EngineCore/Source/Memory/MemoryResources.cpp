@@ -0,0 +1,61 @@
+#include "Core/Memory/MemoryResources.h"
+#include <algorithm>
+
+namespace Yamen::Core {
+
+namespace {
+
+thread_local std::pmr::memory_resource* t_ScratchResource = nullptr;
+
+} // namespace
+
+void* LinearMemoryResource::do_allocate(size_t bytes, size_t alignment) {
+    if (void* ptr = m_Allocator.Allocate(std::max<size_t>(bytes, 1), alignment)) {
+        return ptr;
+    }
+    return m_Upstream->allocate(bytes, alignment);
+}
+
+void LinearMemoryResource::do_deallocate(void* ptr, size_t bytes, size_t alignment) {
+    // Linear memory is only released by Reset()
+    if (!m_Allocator.Owns(ptr)) {
+        m_Upstream->deallocate(ptr, bytes, alignment);
+    }
+}
+
+void* PoolMemoryResource::do_allocate(size_t bytes, size_t alignment) {
+    if (Fits(bytes, alignment)) {
+        return m_Pool.Allocate();
+    }
+    return m_Upstream->allocate(bytes, alignment);
+}
+
+void PoolMemoryResource::do_deallocate(void* ptr, size_t bytes, size_t alignment) {
+    if (Fits(bytes, alignment)) {
+        m_Pool.Free(ptr);
+    }
+    else {
+        m_Upstream->deallocate(ptr, bytes, alignment);
+    }
+}
+
+std::pmr::memory_resource* GetScratchResource() noexcept {
+    return t_ScratchResource ? t_ScratchResource : std::pmr::get_default_resource();
+}
+
+bool HasScratchResource() noexcept {
+    return t_ScratchResource != nullptr;
+}
+
+ScopedScratchResource::ScopedScratchResource(std::pmr::memory_resource* resource) noexcept
+    : m_Previous(t_ScratchResource) {
+    if (resource) {
+        t_ScratchResource = resource;
+    }
+}
+
+ScopedScratchResource::~ScopedScratchResource() {
+    t_ScratchResource = m_Previous;
+}
+
+} // namespace Yamen::Core
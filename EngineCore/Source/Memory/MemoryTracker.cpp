@@ -0,0 +1,357 @@
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Logging/Logger.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+namespace Yamen::Core {
+
+namespace {
+
+constexpr size_t TagCount = static_cast<size_t>(MemoryTag::Count);
+constexpr int64_t PublishBytes = 64 * 1024;
+constexpr uint32_t PublishOperations = 256;
+
+// Everything here is constant-initialized and never allocates, because the
+// global operator new hook records through it (possibly before main)
+struct GlobalCounters {
+    std::array<std::atomic<int64_t>, TagCount> live{};
+    std::array<std::atomic<int64_t>, TagCount> peak{};
+    std::array<std::atomic<uint64_t>, TagCount> allocations{};
+    std::array<std::atomic<uint64_t>, TagCount> frees{};
+};
+
+GlobalCounters g_Counters;
+
+/**
+ * @brief Unpublished counts of one thread
+ *
+ * Only the owning thread writes; snapshots read the atomics concurrently.
+ */
+struct ThreadCounters {
+    std::array<std::atomic<int64_t>, TagCount> live{};
+    std::array<std::atomic<uint64_t>, TagCount> allocations{};
+    std::array<std::atomic<uint64_t>, TagCount> frees{};
+    std::array<int64_t, TagCount> highestLive{};    // Highest pending live bytes since the last publish
+    uint32_t operations = 0;
+
+    ThreadCounters* prev = nullptr;
+    ThreadCounters* next = nullptr;
+    bool registered = false;
+    bool retired = false;       // Thread is exiting: record straight into the globals
+};
+
+std::mutex g_ThreadListMutex;
+ThreadCounters* g_ThreadList = nullptr;
+
+thread_local ThreadCounters t_Counters;
+thread_local MemoryTag t_CurrentTag = MemoryTag::General;
+thread_local bool t_SuppressHeapHook = false;
+
+void PublishPeak(size_t index, int64_t live) noexcept {
+    int64_t peak = g_Counters.peak[index].load(std::memory_order_relaxed);
+    while (live > peak && !g_Counters.peak[index].compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
+
+void Publish(ThreadCounters& counters) noexcept {
+    for (size_t i = 0; i < TagCount; ++i) {
+        const int64_t live = counters.live[i].load(std::memory_order_relaxed);
+        const uint64_t allocations = counters.allocations[i].load(std::memory_order_relaxed);
+        const uint64_t frees = counters.frees[i].load(std::memory_order_relaxed);
+        if (live == 0 && allocations == 0 && frees == 0) {
+            continue;
+        }
+
+        // The thread's high point within the batch, on top of the published total
+        const int64_t published = g_Counters.live[i].fetch_add(live, std::memory_order_relaxed);
+        PublishPeak(i, published + std::max(live, counters.highestLive[i]));
+        g_Counters.allocations[i].fetch_add(allocations, std::memory_order_relaxed);
+        g_Counters.frees[i].fetch_add(frees, std::memory_order_relaxed);
+
+        counters.live[i].store(0, std::memory_order_relaxed);
+        counters.allocations[i].store(0, std::memory_order_relaxed);
+        counters.frees[i].store(0, std::memory_order_relaxed);
+        counters.highestLive[i] = 0;
+    }
+    counters.operations = 0;
+}
+
+/**
+ * @brief Unlinks the thread's counters when the thread exits
+ */
+struct ThreadRegistration {
+    ~ThreadRegistration() {
+        std::lock_guard<std::mutex> lock(g_ThreadListMutex);
+        Publish(t_Counters);
+
+        if (t_Counters.prev) {
+            t_Counters.prev->next = t_Counters.next;
+        }
+        else {
+            g_ThreadList = t_Counters.next;
+        }
+        if (t_Counters.next) {
+            t_Counters.next->prev = t_Counters.prev;
+        }
+        t_Counters.retired = true;
+    }
+};
+
+thread_local ThreadRegistration t_Registration;
+
+void Register(ThreadCounters& counters) noexcept {
+    // Touching the registration arms its destructor for this thread
+    (void)&t_Registration;
+
+    std::lock_guard<std::mutex> lock(g_ThreadListMutex);
+    counters.next = g_ThreadList;
+    if (g_ThreadList) {
+        g_ThreadList->prev = &counters;
+    }
+    g_ThreadList = &counters;
+    counters.registered = true;
+}
+
+void Record(MemoryTag tag, int64_t bytes, bool allocation) noexcept {
+    const size_t index = static_cast<size_t>(tag) < TagCount ? static_cast<size_t>(tag) : 0;
+    ThreadCounters& counters = t_Counters;
+
+    if (counters.retired) {
+        PublishPeak(index, g_Counters.live[index].fetch_add(bytes, std::memory_order_relaxed) + bytes);
+        (allocation ? g_Counters.allocations : g_Counters.frees)[index].fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    if (!counters.registered) {
+        Register(counters);
+    }
+
+    const int64_t live = counters.live[index].load(std::memory_order_relaxed) + bytes;
+    counters.live[index].store(live, std::memory_order_relaxed);
+    counters.highestLive[index] = std::max(counters.highestLive[index], live);
+
+    auto& count = (allocation ? counters.allocations : counters.frees)[index];
+    count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    if (live >= PublishBytes || live <= -PublishBytes || ++counters.operations >= PublishOperations) {
+        Publish(counters);
+    }
+}
+
+} // namespace
+
+std::string_view ToString(MemoryTag tag) noexcept {
+    switch (tag) {
+        case MemoryTag::General:   return "General";
+        case MemoryTag::Core:      return "Core";
+        case MemoryTag::ECS:       return "ECS";
+        case MemoryTag::Physics:   return "Physics";
+        case MemoryTag::Animation: return "Animation";
+        case MemoryTag::World:     return "World";
+        case MemoryTag::Assets:    return "Assets";
+        case MemoryTag::Graphics:  return "Graphics";
+        case MemoryTag::Network:   return "Network";
+        default:                   return "Unknown";
+    }
+}
+
+MemoryTagStats MemorySnapshot::Total() const noexcept {
+    MemoryTagStats total;
+    for (const MemoryTagStats& stats : tags) {
+        total.liveBytes += stats.liveBytes;
+        total.peakBytes += stats.peakBytes;
+        total.allocations += stats.allocations;
+        total.frees += stats.frees;
+    }
+    return total;
+}
+
+MemorySnapshot MemorySnapshot::Diff(const MemorySnapshot& baseline) const noexcept {
+    MemorySnapshot diff;
+    for (size_t i = 0; i < tags.size(); ++i) {
+        diff.tags[i].liveBytes = tags[i].liveBytes - baseline.tags[i].liveBytes;
+        diff.tags[i].peakBytes = tags[i].peakBytes;
+        diff.tags[i].allocations = tags[i].allocations - baseline.tags[i].allocations;
+        diff.tags[i].frees = tags[i].frees - baseline.tags[i].frees;
+    }
+    return diff;
+}
+
+void MemorySnapshot::Log(std::string_view title) const {
+    YAMEN_CORE_INFO("Memory: {}", title);
+    for (size_t i = 0; i < tags.size(); ++i) {
+        const MemoryTagStats& stats = tags[i];
+        if (stats.liveBytes == 0 && stats.peakBytes == 0 && stats.allocations == 0 && stats.frees == 0) {
+            continue;
+        }
+        YAMEN_CORE_INFO("  - {:<10} live {:>10.1f} KB, peak {:>10.1f} KB, {} allocs, {} frees",
+            ToString(static_cast<MemoryTag>(i)), stats.liveBytes / 1024.0, stats.peakBytes / 1024.0,
+            stats.allocations, stats.frees);
+    }
+
+    const MemoryTagStats total = Total();
+    YAMEN_CORE_INFO("  - {:<10} live {:>10.1f} KB, {} allocs, {} frees",
+        "Total", total.liveBytes / 1024.0, total.allocations, total.frees);
+}
+
+void MemoryTracker::RecordAllocation(MemoryTag tag, size_t bytes) noexcept {
+    Record(tag, static_cast<int64_t>(bytes), true);
+}
+
+void MemoryTracker::RecordFree(MemoryTag tag, size_t bytes) noexcept {
+    Record(tag, -static_cast<int64_t>(bytes), false);
+}
+
+void* MemoryTracker::Allocate(size_t size, size_t alignment, MemoryTag tag) {
+    t_SuppressHeapHook = true;
+    void* ptr = nullptr;
+    try {
+        ptr = ::operator new(size, std::align_val_t(alignment));
+    }
+    catch (...) {
+        t_SuppressHeapHook = false;
+        throw;
+    }
+    t_SuppressHeapHook = false;
+
+    RecordAllocation(tag, size);
+    return ptr;
+}
+
+void MemoryTracker::Free(void* ptr, size_t size, size_t alignment, MemoryTag tag) noexcept {
+    if (!ptr) {
+        return;
+    }
+
+    t_SuppressHeapHook = true;
+    ::operator delete(ptr, std::align_val_t(alignment));
+    t_SuppressHeapHook = false;
+
+    RecordFree(tag, size);
+}
+
+MemoryTag MemoryTracker::GetCurrentTag() noexcept {
+    return t_CurrentTag;
+}
+
+MemoryTag MemoryTracker::SetCurrentTag(MemoryTag tag) noexcept {
+    const MemoryTag previous = t_CurrentTag;
+    t_CurrentTag = tag;
+    return previous;
+}
+
+MemorySnapshot MemoryTracker::GetSnapshot() {
+    MemorySnapshot snapshot;
+
+    std::lock_guard<std::mutex> lock(g_ThreadListMutex);
+    for (size_t i = 0; i < TagCount; ++i) {
+        MemoryTagStats& stats = snapshot.tags[i];
+        stats.liveBytes = g_Counters.live[i].load(std::memory_order_relaxed);
+        stats.peakBytes = g_Counters.peak[i].load(std::memory_order_relaxed);
+        stats.allocations = g_Counters.allocations[i].load(std::memory_order_relaxed);
+        stats.frees = g_Counters.frees[i].load(std::memory_order_relaxed);
+    }
+
+    for (ThreadCounters* counters = g_ThreadList; counters; counters = counters->next) {
+        for (size_t i = 0; i < TagCount; ++i) {
+            snapshot.tags[i].liveBytes += counters->live[i].load(std::memory_order_relaxed);
+            snapshot.tags[i].allocations += counters->allocations[i].load(std::memory_order_relaxed);
+            snapshot.tags[i].frees += counters->frees[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    for (MemoryTagStats& stats : snapshot.tags) {
+        stats.peakBytes = std::max(stats.peakBytes, stats.liveBytes);
+    }
+    return snapshot;
+}
+
+} // namespace Yamen::Core
+
+#ifdef YAMEN_TRACK_MEMORY
+
+// ============================================================================
+// Global heap hook: every operator new/delete is charged to the current tag.
+// Each block carries a small header with its size, tag and offset from the
+// malloc'd pointer (for over-aligned blocks).
+// ============================================================================
+
+namespace {
+
+struct AllocationHeader {
+    size_t size;
+    uint32_t offset;
+    Yamen::Core::MemoryTag tag;
+};
+
+constexpr size_t HeaderSize = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+static_assert(sizeof(AllocationHeader) <= HeaderSize, "Allocation header must fit in the default alignment");
+
+void* TrackedAllocate(size_t size, size_t alignment) noexcept {
+    alignment = std::max(alignment, HeaderSize);
+
+    auto* raw = static_cast<uint8_t*>(std::malloc(size + HeaderSize + alignment));
+    if (!raw) {
+        return nullptr;
+    }
+
+    const uintptr_t user = (reinterpret_cast<uintptr_t>(raw) + HeaderSize + alignment - 1) & ~(alignment - 1);
+    auto* header = reinterpret_cast<AllocationHeader*>(user - HeaderSize);
+    header->size = size;
+    header->offset = static_cast<uint32_t>(user - reinterpret_cast<uintptr_t>(raw));
+    header->tag = Yamen::Core::t_CurrentTag;
+
+    if (!Yamen::Core::t_SuppressHeapHook) {
+        Yamen::Core::MemoryTracker::RecordAllocation(header->tag, size);
+    }
+    return reinterpret_cast<void*>(user);
+}
+
+void TrackedFree(void* ptr) noexcept {
+    if (!ptr) {
+        return;
+    }
+
+    auto* header = reinterpret_cast<AllocationHeader*>(static_cast<uint8_t*>(ptr) - HeaderSize);
+    if (!Yamen::Core::t_SuppressHeapHook) {
+        Yamen::Core::MemoryTracker::RecordFree(header->tag, header->size);
+    }
+    std::free(static_cast<uint8_t*>(ptr) - header->offset);
+}
+
+void* TrackedAllocateOrThrow(size_t size, size_t alignment) {
+    void* ptr = TrackedAllocate(size, alignment);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+} // namespace
+
+void* operator new(size_t size) { return TrackedAllocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](size_t size) { return TrackedAllocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(size_t size, std::align_val_t alignment) { return TrackedAllocateOrThrow(size, static_cast<size_t>(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment) { return TrackedAllocateOrThrow(size, static_cast<size_t>(alignment)); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return TrackedAllocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return TrackedAllocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return TrackedAllocate(size, static_cast<size_t>(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return TrackedAllocate(size, static_cast<size_t>(alignment)); }
+
+void operator delete(void* ptr) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr) noexcept { TrackedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { TrackedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { TrackedFree(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { TrackedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { TrackedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { TrackedFree(ptr); }
+
+#endif // YAMEN_TRACK_MEMORY
@@ -1,139 +1,237 @@
 #include "Core/Memory/PoolAllocator.h"
-#include <cstdlib>
+#include "Core/Memory/LinearAllocator.h"
+#include "Core/Memory/ThreadSlots.h"
+#include "Core/Logging/Logger.h"
 #include <algorithm>
-#include <malloc.h> // For _aligned_malloc
+#include <new>
 
 namespace Yamen::Core {
 
-// Helper for alignment
-static constexpr size_t AlignUp(size_t value, size_t alignment) noexcept {
-    return (value + alignment - 1) & ~(alignment - 1);
-}
+PoolAllocator::PoolAllocator(size_t objectSize, size_t objectAlignment, size_t initialCapacity, MemoryTag tag)
+    : m_ObjectAlignment(std::max(objectAlignment, alignof(FreeNode)))
+    , m_InitialCapacity(std::max<size_t>(initialCapacity, 1))
+    , m_Tag(tag)
+    , m_Caches(std::make_unique<ThreadCache[]>(MaxThreadCaches)) {
 
-PoolAllocator::PoolAllocator(size_t objectSize, size_t objectAlignment, size_t initialCapacity)
-    : m_ObjectSize(std::max(objectSize, sizeof(FreeNode)))
-    , m_ObjectAlignment(objectAlignment)
-    , m_Capacity(initialCapacity)
-    , m_AllocatedCount(0) {
-    
     // Align object size
-    m_ObjectSize = AlignUp(m_ObjectSize, m_ObjectAlignment);
-    
-    // Allocate buffer
-    const size_t bufferSize = m_ObjectSize * m_Capacity;
-    
-    // Use _aligned_malloc for Windows compatibility
-    m_Buffer = static_cast<uint8_t*>(_aligned_malloc(bufferSize, m_ObjectAlignment));
-    
-    if (!m_Buffer) {
-        throw std::bad_alloc();
+    m_ObjectSize = AlignUp(std::max(objectSize, sizeof(FreeNode)), m_ObjectAlignment);
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    Grow();
+}
+
+PoolAllocator::~PoolAllocator() {
+#ifdef _DEBUG
+    const size_t leaked = GetAllocatedCount();
+    if (leaked > 0) {
+        YAMEN_CORE_WARN("PoolAllocator destroyed with {} objects still allocated", leaked);
+    }
+#endif
+
+    const size_t segmentCount = m_SegmentCount.load(std::memory_order_acquire);
+    for (size_t i = 0; i < segmentCount; ++i) {
+        MemoryTracker::Free(m_Segments[i].memory, m_Segments[i].objectCount * m_ObjectSize, m_ObjectAlignment, m_Tag);
+        m_Segments[i].memory = nullptr;
+    }
+}
+
+void* PoolAllocator::Allocate() {
+    FreeNode* node = nullptr;
+
+    const uint32_t slot = ThreadSlots::Current();
+    if (slot == ThreadSlots::NoSlot) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        node = PopShared();
+        m_UncachedAllocated.fetch_add(1, std::memory_order_relaxed);
+    }
+    else {
+        ThreadCache& cache = m_Caches[slot];
+        if (!cache.head) {
+            RefillCache(cache);
+        }
+
+        node = cache.head;
+        cache.head = node->next;
+        cache.count--;
+        cache.allocated.store(cache.allocated.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+#ifdef _DEBUG
+    MarkLive(node, true);
+#endif
+    return node;
+}
+
+void PoolAllocator::Free(void* ptr) noexcept {
+    if (!ptr) {
+        return;
+    }
+
+#ifdef _DEBUG
+    if (!ValidateFree(ptr)) {
+        return;     // Leak rather than corrupt the free lists
     }
-    
-    // Initialize free list
-    m_FreeList = nullptr;
-    for (size_t i = 0; i < m_Capacity; ++i) {
-        void* ptr = m_Buffer + (i * m_ObjectSize);
-        FreeNode* node = static_cast<FreeNode*>(ptr);
+    MarkLive(ptr, false);
+#endif
+
+    FreeNode* node = static_cast<FreeNode*>(ptr);
+
+    const uint32_t slot = ThreadSlots::Current();
+    if (slot == ThreadSlots::NoSlot) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
         node->next = m_FreeList;
         m_FreeList = node;
+        m_UncachedAllocated.fetch_sub(1, std::memory_order_relaxed);
+        return;
+    }
+
+    ThreadCache& cache = m_Caches[slot];
+    node->next = cache.head;
+    cache.head = node;
+    cache.allocated.store(cache.allocated.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+
+    if (++cache.count > MaxCachedObjects) {
+        // Hand a batch back so objects freed on a consumer thread can be reused by producers
+        ReturnBatch(cache, BatchSize);
     }
 }
 
-PoolAllocator::~PoolAllocator() {
-    if (m_Buffer) {
-        _aligned_free(m_Buffer);
-        m_Buffer = nullptr;
+bool PoolAllocator::Owns(const void* ptr) const noexcept {
+    const Segment* segment = FindSegment(ptr);
+    if (!segment) {
+        return false;
     }
+
+    const size_t offset = static_cast<size_t>(static_cast<const uint8_t*>(ptr) - segment->memory);
+    return offset % m_ObjectSize == 0;
 }
 
-PoolAllocator::PoolAllocator(PoolAllocator&& other) noexcept
-    : m_Buffer(other.m_Buffer)
-    , m_FreeList(other.m_FreeList)
-    , m_ObjectSize(other.m_ObjectSize)
-    , m_ObjectAlignment(other.m_ObjectAlignment)
-    , m_Capacity(other.m_Capacity)
-    , m_AllocatedCount(other.m_AllocatedCount) {
-    
-    other.m_Buffer = nullptr;
-    other.m_FreeList = nullptr;
-    other.m_Capacity = 0;
-    other.m_AllocatedCount = 0;
+void PoolAllocator::FlushThreadCache() noexcept {
+    const uint32_t slot = ThreadSlots::Current();
+    if (slot != ThreadSlots::NoSlot && m_Caches[slot].head) {
+        ReturnBatch(m_Caches[slot], m_Caches[slot].count);
+    }
 }
 
-PoolAllocator& PoolAllocator::operator=(PoolAllocator&& other) noexcept {
-    if (this != &other) {
-        if (m_Buffer) {
-            _aligned_free(m_Buffer);
-        }
-        
-        m_Buffer = other.m_Buffer;
-        m_FreeList = other.m_FreeList;
-        m_ObjectSize = other.m_ObjectSize;
-        m_ObjectAlignment = other.m_ObjectAlignment;
-        m_Capacity = other.m_Capacity;
-        m_AllocatedCount = other.m_AllocatedCount;
-        
-        other.m_Buffer = nullptr;
-        other.m_FreeList = nullptr;
-        other.m_Capacity = 0;
-        other.m_AllocatedCount = 0;
-    }
-    return *this;
+size_t PoolAllocator::GetAllocatedCount() const noexcept {
+    int64_t allocated = m_UncachedAllocated.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < MaxThreadCaches; ++i) {
+        allocated += m_Caches[i].allocated.load(std::memory_order_relaxed);
+    }
+    return allocated > 0 ? static_cast<size_t>(allocated) : 0;
 }
 
-void* PoolAllocator::Allocate() {
-    if (!m_FreeList) {
-        Grow();
+void PoolAllocator::RefillCache(ThreadCache& cache) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    // Take up to one batch, growing only if the shared list is empty
+    FreeNode* head = PopShared();
+    FreeNode* tail = head;
+    size_t count = 1;
+    while (count < BatchSize && m_FreeList) {
+        tail->next = m_FreeList;
+        tail = m_FreeList;
+        m_FreeList = m_FreeList->next;
+        ++count;
+    }
+
+    tail->next = nullptr;
+    cache.head = head;
+    cache.count = count;
+}
+
+void PoolAllocator::ReturnBatch(ThreadCache& cache, size_t count) noexcept {
+    FreeNode* head = cache.head;
+    FreeNode* tail = head;
+    for (size_t i = 1; i < count; ++i) {
+        tail = tail->next;
     }
-    
+
+    cache.head = tail->next;
+    cache.count -= count;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    tail->next = m_FreeList;
+    m_FreeList = head;
+}
+
+PoolAllocator::FreeNode* PoolAllocator::PopShared() {
     if (!m_FreeList) {
-        return nullptr;
+        Grow();
     }
-    
+
     FreeNode* node = m_FreeList;
     m_FreeList = node->next;
-    m_AllocatedCount++;
-    
     return node;
 }
 
-void PoolAllocator::Free(void* ptr) noexcept {
-    if (!ptr) {
-        return;
-    }
-    
-    FreeNode* node = static_cast<FreeNode*>(ptr);
-    node->next = m_FreeList;
-    m_FreeList = node;
-    m_AllocatedCount--;
-}
-
 void PoolAllocator::Grow() {
-    const size_t newCapacity = m_Capacity * 2;
-    const size_t newBufferSize = m_ObjectSize * newCapacity;
-    
-    uint8_t* newBuffer = static_cast<uint8_t*>(_aligned_malloc(newBufferSize, m_ObjectAlignment));
-    if (!newBuffer) {
-        return;
+    const size_t segmentIndex = m_SegmentCount.load(std::memory_order_relaxed);
+    if (segmentIndex == MaxSegments) {
+        throw std::bad_alloc();
     }
-    
-    // Copy old buffer
-    if (m_Buffer) {
-        std::memcpy(newBuffer, m_Buffer, m_ObjectSize * m_Capacity);
-        _aligned_free(m_Buffer);
-    }
-    
-    m_Buffer = newBuffer;
-    
-    // Add new objects to free list
-    for (size_t i = m_Capacity; i < newCapacity; ++i) {
-        void* ptr = m_Buffer + (i * m_ObjectSize);
-        FreeNode* node = static_cast<FreeNode*>(ptr);
+
+    // Each new segment doubles the total capacity; existing segments never move
+    const size_t objectCount = std::max(m_InitialCapacity, m_Capacity.load(std::memory_order_relaxed));
+
+    Segment& segment = m_Segments[segmentIndex];
+    segment.memory = static_cast<uint8_t*>(MemoryTracker::Allocate(objectCount * m_ObjectSize, m_ObjectAlignment, m_Tag));
+    segment.objectCount = objectCount;
+#ifdef _DEBUG
+    segment.live = std::make_unique<std::atomic<uint8_t>[]>(objectCount);
+#endif
+
+    // Add new objects to free list, lowest address first
+    for (size_t i = objectCount; i-- > 0; ) {
+        FreeNode* node = reinterpret_cast<FreeNode*>(segment.memory + i * m_ObjectSize);
         node->next = m_FreeList;
         m_FreeList = node;
     }
-    
-    m_Capacity = newCapacity;
+
+    m_Capacity.fetch_add(objectCount, std::memory_order_relaxed);
+    m_SegmentCount.store(segmentIndex + 1, std::memory_order_release);
+}
+
+const PoolAllocator::Segment* PoolAllocator::FindSegment(const void* ptr) const noexcept {
+    const auto* bytes = static_cast<const uint8_t*>(ptr);
+    const size_t segmentCount = m_SegmentCount.load(std::memory_order_acquire);
+
+    for (size_t i = 0; i < segmentCount; ++i) {
+        const Segment& segment = m_Segments[i];
+        if (bytes >= segment.memory && bytes < segment.memory + segment.objectCount * m_ObjectSize) {
+            return &segment;
+        }
+    }
+    return nullptr;
+}
+
+#ifdef _DEBUG
+bool PoolAllocator::ValidateFree(void* ptr) const noexcept {
+    const Segment* segment = FindSegment(ptr);
+    if (!segment) {
+        YAMEN_CORE_CRITICAL("PoolAllocator::Free: {} was not allocated from this pool", ptr);
+        return false;
+    }
+
+    const size_t offset = static_cast<size_t>(static_cast<uint8_t*>(ptr) - segment->memory);
+    if (offset % m_ObjectSize != 0) {
+        YAMEN_CORE_CRITICAL("PoolAllocator::Free: {} points into the middle of an object", ptr);
+        return false;
+    }
+
+    if (!segment->live[offset / m_ObjectSize].load(std::memory_order_relaxed)) {
+        YAMEN_CORE_CRITICAL("PoolAllocator::Free: {} freed twice", ptr);
+        return false;
+    }
+
+    return true;
+}
+
+void PoolAllocator::MarkLive(void* ptr, bool live) const noexcept {
+    const Segment* segment = FindSegment(ptr);
+    const size_t offset = static_cast<size_t>(static_cast<uint8_t*>(ptr) - segment->memory);
+    segment->live[offset / m_ObjectSize].store(live ? 1 : 0, std::memory_order_relaxed);
 }
+#endif
 
 } // namespace Yamen::Core
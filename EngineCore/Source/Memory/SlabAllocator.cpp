@@ -0,0 +1,203 @@
+#include "Core/Memory/SlabAllocator.h"
+#include "Core/Memory/MemoryTracker.h"
+#include <array>
+#include <atomic>
+#include <mutex>
+
+namespace Yamen::Core {
+
+namespace {
+
+struct FreeBlock {
+    FreeBlock* next;
+};
+
+constexpr size_t BatchSize = 32;         // Blocks moved between thread cache and global list at once
+constexpr size_t MaxCachedBlocks = 256;  // Per size class, per thread
+
+constexpr size_t SizeClassIndex(size_t size) noexcept {
+    size_t index = 0;
+    size_t blockSize = SlabAllocator::MinBlockSize;
+    while (blockSize < size) {
+        blockSize <<= 1;
+        ++index;
+    }
+    return index;
+}
+
+constexpr size_t BlockSizeOf(size_t index) noexcept {
+    return SlabAllocator::MinBlockSize << index;
+}
+
+/**
+ * @brief Process-wide free lists, refilled from new slabs
+ */
+class GlobalSlabPool {
+public:
+    static GlobalSlabPool& Get() {
+        // Intentionally never destroyed: thread caches of late-exiting threads
+        // may still return blocks during static destruction
+        static GlobalSlabPool* instance = new GlobalSlabPool();
+        return *instance;
+    }
+
+    // Pops up to BatchSize blocks into a chain; returns its length
+    size_t TakeBatch(size_t index, FreeBlock*& outHead) {
+        SizeClass& sizeClass = m_Classes[index];
+        std::lock_guard<std::mutex> lock(sizeClass.mutex);
+
+        if (!sizeClass.head) {
+            CarveSlab(sizeClass, index);
+        }
+
+        FreeBlock* head = sizeClass.head;
+        FreeBlock* tail = head;
+        size_t count = 1;
+        while (count < BatchSize && tail->next) {
+            tail = tail->next;
+            ++count;
+        }
+
+        sizeClass.head = tail->next;
+        tail->next = nullptr;
+        outHead = head;
+        return count;
+    }
+
+    void ReturnChain(size_t index, FreeBlock* head, FreeBlock* tail) {
+        SizeClass& sizeClass = m_Classes[index];
+        std::lock_guard<std::mutex> lock(sizeClass.mutex);
+        tail->next = sizeClass.head;
+        sizeClass.head = head;
+    }
+
+    SlabAllocator::Stats GetStats() const noexcept {
+        SlabAllocator::Stats stats;
+        stats.slabCount = m_SlabCount.load(std::memory_order_relaxed);
+        stats.reservedBytes = stats.slabCount * SlabAllocator::SlabSize;
+        stats.oversizedAllocations = m_OversizedCount.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void CountOversized() noexcept {
+        m_OversizedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+private:
+    struct SizeClass {
+        std::mutex mutex;
+        FreeBlock* head = nullptr;
+    };
+
+    void CarveSlab(SizeClass& sizeClass, size_t index) {
+        // Slabs are shared by every subsystem and never released
+        auto* slab = static_cast<uint8_t*>(MemoryTracker::Allocate(
+            SlabAllocator::SlabSize, SlabAllocator::BlockAlignment, MemoryTag::Core));
+        m_SlabCount.fetch_add(1, std::memory_order_relaxed);
+
+        const size_t blockSize = BlockSizeOf(index);
+        const size_t blockCount = SlabAllocator::SlabSize / blockSize;
+
+        for (size_t i = blockCount; i-- > 0; ) {
+            auto* block = reinterpret_cast<FreeBlock*>(slab + i * blockSize);
+            block->next = sizeClass.head;
+            sizeClass.head = block;
+        }
+    }
+
+    std::array<SizeClass, SlabAllocator::SizeClassCount> m_Classes;
+    std::atomic<size_t> m_SlabCount{ 0 };
+    std::atomic<size_t> m_OversizedCount{ 0 };
+};
+
+/**
+ * @brief Per-thread free lists; flushed back to the global pool on thread exit
+ */
+struct ThreadCache {
+    std::array<FreeBlock*, SlabAllocator::SizeClassCount> heads{};
+    std::array<size_t, SlabAllocator::SizeClassCount> counts{};
+
+    ~ThreadCache() {
+        for (size_t index = 0; index < heads.size(); ++index) {
+            if (!heads[index]) {
+                continue;
+            }
+            FreeBlock* tail = heads[index];
+            while (tail->next) {
+                tail = tail->next;
+            }
+            GlobalSlabPool::Get().ReturnChain(index, heads[index], tail);
+            heads[index] = nullptr;
+            counts[index] = 0;
+        }
+    }
+
+    void* Pop(size_t index) {
+        if (!heads[index]) {
+            counts[index] = GlobalSlabPool::Get().TakeBatch(index, heads[index]);
+        }
+
+        FreeBlock* block = heads[index];
+        heads[index] = block->next;
+        counts[index]--;
+        return block;
+    }
+
+    void Push(size_t index, void* ptr) noexcept {
+        auto* block = static_cast<FreeBlock*>(ptr);
+        block->next = heads[index];
+        heads[index] = block;
+
+        if (++counts[index] > MaxCachedBlocks) {
+            // Hand a batch back so memory freed on a consumer thread can be reused by producers
+            FreeBlock* head = heads[index];
+            FreeBlock* tail = head;
+            for (size_t i = 1; i < BatchSize; ++i) {
+                tail = tail->next;
+            }
+            heads[index] = tail->next;
+            counts[index] -= BatchSize;
+            GlobalSlabPool::Get().ReturnChain(index, head, tail);
+        }
+    }
+};
+
+thread_local ThreadCache t_Cache;
+
+} // namespace
+
+void* SlabAllocator::Allocate(size_t size, size_t alignment) {
+    if (!IsPooled(size, alignment)) {
+        GlobalSlabPool::Get().CountOversized();
+        if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            return ::operator new(size, std::align_val_t(alignment));
+        }
+        return ::operator new(size);
+    }
+
+    return t_Cache.Pop(SizeClassIndex(size));
+}
+
+void SlabAllocator::Free(void* ptr, size_t size, size_t alignment) noexcept {
+    if (!ptr) {
+        return;
+    }
+
+    if (!IsPooled(size, alignment)) {
+        if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            ::operator delete(ptr, std::align_val_t(alignment));
+        }
+        else {
+            ::operator delete(ptr);
+        }
+        return;
+    }
+
+    t_Cache.Push(SizeClassIndex(size), ptr);
+}
+
+SlabAllocator::Stats SlabAllocator::GetStats() noexcept {
+    return GlobalSlabPool::Get().GetStats();
+}
+
+} // namespace Yamen::Core
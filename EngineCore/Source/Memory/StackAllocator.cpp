@@ -0,0 +1,110 @@
+#include "Core/Memory/StackAllocator.h"
+#include "Core/Logging/Logger.h"
+#include <algorithm>
+#include <cstring>
+
+namespace Yamen::Core {
+
+namespace {
+
+#ifdef _DEBUG
+constexpr uint64_t CanaryPattern = 0x5AC4CA4A5AC4CA4Aull;
+constexpr uint8_t ReleasedPattern = 0xCD;
+
+uint64_t CanaryFor(size_t offset, uint32_t depth) noexcept {
+    return CanaryPattern ^ (static_cast<uint64_t>(depth) << 48) ^ offset;
+}
+#endif
+
+} // namespace
+
+StackAllocator::StackAllocator(size_t capacity, MemoryTag tag)
+    : m_Capacity(capacity)
+    , m_Tag(tag) {
+    m_Buffer = static_cast<uint8_t*>(MemoryTracker::Allocate(m_Capacity, BufferAlignment, m_Tag));
+}
+
+StackAllocator::~StackAllocator() {
+#ifdef _DEBUG
+    if (m_Depth != 0) {
+        YAMEN_CORE_WARN("StackAllocator destroyed with {} markers still open", m_Depth);
+    }
+#endif
+    MemoryTracker::Free(m_Buffer, m_Capacity, BufferAlignment, m_Tag);
+    m_Buffer = nullptr;
+}
+
+StackAllocator& StackAllocator::ForThread() {
+    thread_local StackAllocator stack(DefaultThreadStackSize, MemoryTag::Core);
+    return stack;
+}
+
+void StackAllocator::Reset() noexcept {
+    m_Offset = 0;
+#ifdef _DEBUG
+    m_Depth = 0;
+#endif
+}
+
+void* StackAllocator::do_allocate(size_t bytes, size_t alignment) {
+    if (void* ptr = Allocate(std::max<size_t>(bytes, 1), alignment)) {
+        return ptr;
+    }
+    return std::pmr::get_default_resource()->allocate(bytes, alignment);
+}
+
+void StackAllocator::do_deallocate(void* ptr, size_t bytes, size_t alignment) {
+    if (!Owns(ptr)) {
+        std::pmr::get_default_resource()->deallocate(ptr, bytes, alignment);
+        return;
+    }
+
+    // The topmost block can be popped right away (e.g. a vector's last growth)
+    auto* block = static_cast<uint8_t*>(ptr);
+    if (block + std::max<size_t>(bytes, 1) == m_Buffer + m_Offset) {
+        m_Offset = static_cast<size_t>(block - m_Buffer);
+    }
+}
+
+#ifdef _DEBUG
+StackAllocator::Marker StackAllocator::PushCanary() noexcept {
+    Marker marker{ m_Offset, ++m_Depth };
+
+    void* canary = Allocate(sizeof(uint64_t), alignof(uint64_t));
+    if (canary) {
+        const uint64_t value = CanaryFor(marker.offset, marker.depth);
+        std::memcpy(canary, &value, sizeof(value));
+    }
+    return marker;
+}
+
+void StackAllocator::PopCanary(const Marker& marker) noexcept {
+    if (marker.depth != m_Depth) {
+        YAMEN_CORE_CRITICAL("StackAllocator: marker at depth {} rolled back while depth {} is open (out-of-order release)",
+            marker.depth, m_Depth);
+    }
+    else if (marker.offset > m_Offset) {
+        YAMEN_CORE_CRITICAL("StackAllocator: marker at offset {} is above the stack top {}", marker.offset, m_Offset);
+    }
+    else {
+        // A missing canary means the stack was full when the marker was taken
+        const uintptr_t base = reinterpret_cast<uintptr_t>(m_Buffer);
+        const size_t canaryOffset = AlignUp(base + marker.offset, alignof(uint64_t)) - base;
+        if (canaryOffset + sizeof(uint64_t) <= m_Offset) {
+            uint64_t value = 0;
+            std::memcpy(&value, m_Buffer + canaryOffset, sizeof(value));
+            if (value != CanaryFor(marker.offset, marker.depth)) {
+                YAMEN_CORE_CRITICAL("StackAllocator: canary at offset {} overwritten (overrun, or an outer marker was released first)",
+                    canaryOffset);
+            }
+        }
+
+        std::memset(m_Buffer + marker.offset, ReleasedPattern, m_Offset - marker.offset);
+        m_Offset = marker.offset;
+    }
+
+    m_Depth = marker.depth > 0 ? marker.depth - 1 : 0;
+}
+#endif
+
+} // namespace Yamen::Core
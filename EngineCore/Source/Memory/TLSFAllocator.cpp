@@ -0,0 +1,346 @@
+#include "Core/Memory/TLSFAllocator.h"
+#include "Core/Memory/LinearAllocator.h"
+#include "Core/Logging/Logger.h"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <stdexcept>
+
+namespace Yamen::Core {
+
+/**
+ * @brief Header in front of every block
+ *
+ * Blocks are laid out back to back; the block after the last one is a zero-sized
+ * sentinel that is always in use, so merging never runs off the end. The free-list
+ * links overlap the payload and only exist while the block is free.
+ */
+struct TLSFAllocator::BlockHeader {
+    static constexpr size_t FreeBit = 1;
+    static constexpr size_t PrevFreeBit = 2;
+
+    BlockHeader* prevPhysical;      // Only valid while the previous block is free
+    size_t sizeAndFlags;            // Payload size; the low bits hold the flags
+
+    BlockHeader* nextFree;
+    BlockHeader* prevFree;
+
+    size_t GetSize() const noexcept { return sizeAndFlags & ~(FreeBit | PrevFreeBit); }
+    void SetSize(size_t size) noexcept { sizeAndFlags = size | (sizeAndFlags & (FreeBit | PrevFreeBit)); }
+
+    bool IsFree() const noexcept { return sizeAndFlags & FreeBit; }
+    void SetFree(bool free) noexcept { sizeAndFlags = free ? (sizeAndFlags | FreeBit) : (sizeAndFlags & ~FreeBit); }
+
+    bool IsPrevFree() const noexcept { return sizeAndFlags & PrevFreeBit; }
+    void SetPrevFree(bool free) noexcept { sizeAndFlags = free ? (sizeAndFlags | PrevFreeBit) : (sizeAndFlags & ~PrevFreeBit); }
+
+    uint8_t* GetPayload() noexcept { return reinterpret_cast<uint8_t*>(this) + BlockOverhead; }
+
+    BlockHeader* GetNext() noexcept {
+        return reinterpret_cast<BlockHeader*>(GetPayload() + GetSize());
+    }
+
+    /**
+     * @brief Point the next block back at this one
+     */
+    BlockHeader* LinkNext() noexcept {
+        BlockHeader* next = GetNext();
+        next->prevPhysical = this;
+        return next;
+    }
+
+    static BlockHeader* FromPayload(const void* ptr) noexcept {
+        return reinterpret_cast<BlockHeader*>(const_cast<uint8_t*>(static_cast<const uint8_t*>(ptr)) - BlockOverhead);
+    }
+};
+
+TLSFAllocator::TLSFAllocator(size_t budget, MemoryTag tag)
+    : m_Budget(AlignUp(budget, Alignment))
+    , m_Tag(tag) {
+
+    static_assert(offsetof(BlockHeader, nextFree) == BlockOverhead, "Block header must match BlockOverhead");
+    static_assert(sizeof(BlockHeader) - BlockOverhead <= MinBlockSize, "Free-list links must fit in the smallest block");
+
+    if (m_Budget < 2 * BlockOverhead + MinBlockSize || m_Budget >= MaxBudget) {
+        throw std::invalid_argument("TLSFAllocator budget out of range");
+    }
+
+    m_Memory = static_cast<uint8_t*>(MemoryTracker::Allocate(m_Budget, 64, m_Tag));
+
+    // One free block spanning the budget, followed by the sentinel
+    auto* block = reinterpret_cast<BlockHeader*>(m_Memory);
+    block->prevPhysical = nullptr;
+    block->sizeAndFlags = m_Budget - 2 * BlockOverhead;
+    block->SetFree(true);
+
+    BlockHeader* sentinel = block->LinkNext();
+    sentinel->sizeAndFlags = 0;
+    sentinel->SetPrevFree(true);
+
+    InsertFree(block);
+}
+
+TLSFAllocator::~TLSFAllocator() {
+#ifdef _DEBUG
+    if (m_AllocationCount > 0) {
+        YAMEN_CORE_WARN("TLSFAllocator destroyed with {} allocations ({} bytes) outstanding", m_AllocationCount, m_UsedBytes);
+    }
+#endif
+
+    MemoryTracker::Free(m_Memory, m_Budget, 64, m_Tag);
+    m_Memory = nullptr;
+}
+
+void* TLSFAllocator::Allocate(size_t size, size_t alignment) {
+    if (size == 0 || size >= m_Budget) {
+        return nullptr;
+    }
+
+    alignment = std::max(alignment, Alignment);
+    const size_t adjusted = std::max(AlignUp(size, Alignment), MinBlockSize);
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    if (alignment == Alignment) {
+        BlockHeader* block = LocateFree(adjusted);
+        return block ? PrepareUsed(block, adjusted) : nullptr;
+    }
+
+    // Over-aligned: find room for the padding too, then split it off as a free block
+    constexpr size_t gapMinimum = BlockOverhead + MinBlockSize;
+    BlockHeader* block = LocateFree(AlignUp(adjusted + alignment + gapMinimum, Alignment));
+    if (!block) {
+        return nullptr;
+    }
+
+    const uintptr_t payload = reinterpret_cast<uintptr_t>(block->GetPayload());
+    uintptr_t aligned = AlignUp(payload, alignment);
+    if (aligned != payload && aligned - payload < gapMinimum) {
+        aligned = AlignUp(payload + gapMinimum, alignment);
+    }
+
+    if (aligned != payload) {
+        block = TrimFreeLeading(block, aligned - payload);
+    }
+    return PrepareUsed(block, adjusted);
+}
+
+void TLSFAllocator::Free(void* ptr) {
+    if (!ptr) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    BlockHeader* block = BlockHeader::FromPayload(ptr);
+
+#ifdef _DEBUG
+    if (!Owns(ptr) || !IsAligned(ptr, Alignment)) {
+        YAMEN_CORE_CRITICAL("TLSFAllocator: freeing {} which it does not own", ptr);
+        return;
+    }
+    if (block->IsFree()) {
+        YAMEN_CORE_CRITICAL("TLSFAllocator: double free of {}", ptr);
+        return;
+    }
+#endif
+
+    m_UsedBytes -= block->GetSize();
+    --m_AllocationCount;
+
+    block->SetFree(true);
+    block->GetNext()->SetPrevFree(true);
+
+    block = MergePrevious(block);
+    block = MergeNext(block);
+    InsertFree(block);
+}
+
+size_t TLSFAllocator::GetAllocationSize(const void* ptr) noexcept {
+    return ptr ? BlockHeader::FromPayload(ptr)->GetSize() : 0;
+}
+
+TLSFAllocator::Stats TLSFAllocator::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    Stats stats;
+    stats.budget = m_Budget;
+    stats.usedBytes = m_UsedBytes;
+    stats.peakUsedBytes = m_PeakUsedBytes;
+    stats.allocationCount = m_AllocationCount;
+
+    for (auto* block = reinterpret_cast<BlockHeader*>(m_Memory); block->GetSize() != 0; block = block->GetNext()) {
+        if (block->IsFree()) {
+            stats.freeBytes += block->GetSize();
+            stats.largestFreeBlock = std::max(stats.largestFreeBlock, block->GetSize());
+            ++stats.freeBlockCount;
+        }
+    }
+    return stats;
+}
+
+void* TLSFAllocator::do_allocate(size_t bytes, size_t alignment) {
+    void* ptr = Allocate(std::max<size_t>(bytes, 1), alignment);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+TLSFAllocator::BlockHeader* TLSFAllocator::LocateFree(size_t size) {
+    // Round up to the next list boundary, so any block in the list found is large enough
+    if (size >= SmallBlockSize) {
+        size += (size_t(1) << (std::bit_width(size) - 1 - SecondLevelLog2)) - 1;
+    }
+
+    uint32_t fl = 0;
+    uint32_t sl = 0;
+    Mapping(size, fl, sl);
+    if (fl >= FirstLevelCount) {
+        return nullptr;
+    }
+
+    uint32_t slMap = m_SecondLevelMaps[fl] & (~0u << sl);
+    if (!slMap) {
+        const uint32_t flMap = fl + 1 < 32 ? m_FirstLevelMap & (~0u << (fl + 1)) : 0;
+        if (!flMap) {
+            return nullptr;
+        }
+        fl = static_cast<uint32_t>(std::countr_zero(flMap));
+        slMap = m_SecondLevelMaps[fl];
+    }
+    sl = static_cast<uint32_t>(std::countr_zero(slMap));
+
+    BlockHeader* block = m_FreeLists[fl].heads[sl];
+    RemoveFree(block, fl, sl);
+    return block;
+}
+
+void TLSFAllocator::Mapping(size_t size, uint32_t& fl, uint32_t& sl) noexcept {
+    if (size < SmallBlockSize) {
+        // Small blocks: one list per Alignment step
+        fl = 0;
+        sl = static_cast<uint32_t>(size / (SmallBlockSize / SecondLevelCount));
+    }
+    else {
+        const uint32_t msb = static_cast<uint32_t>(std::bit_width(size)) - 1;
+        sl = static_cast<uint32_t>(size >> (msb - SecondLevelLog2)) ^ SecondLevelCount;
+        fl = msb - (FirstLevelShift - 1);
+    }
+}
+
+void* TLSFAllocator::PrepareUsed(BlockHeader* block, size_t size) {
+    TrimFree(block, size);
+
+    block->SetFree(false);
+    block->GetNext()->SetPrevFree(false);
+
+    m_UsedBytes += block->GetSize();
+    m_PeakUsedBytes = std::max(m_PeakUsedBytes, m_UsedBytes);
+    ++m_AllocationCount;
+
+    return block->GetPayload();
+}
+
+void TLSFAllocator::InsertFree(BlockHeader* block) {
+    uint32_t fl = 0;
+    uint32_t sl = 0;
+    Mapping(block->GetSize(), fl, sl);
+
+    BlockHeader*& head = m_FreeLists[fl].heads[sl];
+    block->nextFree = head;
+    block->prevFree = nullptr;
+    if (head) {
+        head->prevFree = block;
+    }
+    head = block;
+
+    m_FirstLevelMap |= 1u << fl;
+    m_SecondLevelMaps[fl] |= 1u << sl;
+}
+
+void TLSFAllocator::RemoveFree(BlockHeader* block) {
+    uint32_t fl = 0;
+    uint32_t sl = 0;
+    Mapping(block->GetSize(), fl, sl);
+    RemoveFree(block, fl, sl);
+}
+
+void TLSFAllocator::RemoveFree(BlockHeader* block, uint32_t fl, uint32_t sl) {
+    if (block->nextFree) {
+        block->nextFree->prevFree = block->prevFree;
+    }
+    if (block->prevFree) {
+        block->prevFree->nextFree = block->nextFree;
+    }
+
+    BlockHeader*& head = m_FreeLists[fl].heads[sl];
+    if (head == block) {
+        head = block->nextFree;
+        if (!head) {
+            m_SecondLevelMaps[fl] &= ~(1u << sl);
+            if (!m_SecondLevelMaps[fl]) {
+                m_FirstLevelMap &= ~(1u << fl);
+            }
+        }
+    }
+}
+
+TLSFAllocator::BlockHeader* TLSFAllocator::MergePrevious(BlockHeader* block) {
+    if (!block->IsPrevFree()) {
+        return block;
+    }
+
+    BlockHeader* prev = block->prevPhysical;
+    RemoveFree(prev);
+    prev->SetSize(prev->GetSize() + BlockOverhead + block->GetSize());
+    prev->LinkNext();
+    return prev;
+}
+
+TLSFAllocator::BlockHeader* TLSFAllocator::MergeNext(BlockHeader* block) {
+    BlockHeader* next = block->GetNext();
+    if (!next->IsFree()) {
+        return block;
+    }
+
+    RemoveFree(next);
+    block->SetSize(block->GetSize() + BlockOverhead + next->GetSize());
+    block->LinkNext();
+    return block;
+}
+
+void TLSFAllocator::TrimFree(BlockHeader* block, size_t size) {
+    if (block->GetSize() < size + BlockOverhead + MinBlockSize) {
+        return;
+    }
+
+    // Split the tail off as a new free block
+    auto* remaining = reinterpret_cast<BlockHeader*>(block->GetPayload() + size);
+    remaining->sizeAndFlags = block->GetSize() - size - BlockOverhead;
+    remaining->SetFree(true);
+    remaining->SetPrevFree(true);
+
+    block->SetSize(size);
+    block->LinkNext();
+    remaining->LinkNext();
+
+    InsertFree(remaining);
+}
+
+TLSFAllocator::BlockHeader* TLSFAllocator::TrimFreeLeading(BlockHeader* block, size_t gap) {
+    // The first gap bytes (header included) stay behind as a free block
+    auto* remaining = reinterpret_cast<BlockHeader*>(reinterpret_cast<uint8_t*>(block) + gap);
+    remaining->sizeAndFlags = block->GetSize() - gap;
+    remaining->SetFree(true);
+    remaining->SetPrevFree(true);
+
+    block->SetSize(gap - BlockOverhead);
+    block->LinkNext();
+    remaining->LinkNext();
+
+    InsertFree(block);
+    return remaining;
+}
+
+} // namespace Yamen::Core
@@ -0,0 +1,61 @@
+#include "Core/Memory/ThreadSlots.h"
+#include <mutex>
+#include <vector>
+
+namespace Yamen::Core {
+
+namespace {
+
+constexpr uint32_t UnassignedSlot = ThreadSlots::NoSlot - 1;
+
+class ThreadSlotRegistry {
+public:
+    static ThreadSlotRegistry& Get() {
+        // Intentionally never destroyed: thread_locals release their slot during thread exit
+        static ThreadSlotRegistry* instance = new ThreadSlotRegistry();
+        return *instance;
+    }
+
+    uint32_t Acquire() {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (!m_FreeSlots.empty()) {
+            const uint32_t slot = m_FreeSlots.back();
+            m_FreeSlots.pop_back();
+            return slot;
+        }
+        return m_NextSlot < ThreadSlots::MaxSlots ? m_NextSlot++ : ThreadSlots::NoSlot;
+    }
+
+    void Release(uint32_t slot) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_FreeSlots.push_back(slot);
+    }
+
+private:
+    std::mutex m_Mutex;
+    std::vector<uint32_t> m_FreeSlots;
+    uint32_t m_NextSlot = 0;
+};
+
+struct ThreadSlot {
+    uint32_t index = UnassignedSlot;
+
+    ~ThreadSlot() {
+        if (index < ThreadSlots::MaxSlots) {
+            ThreadSlotRegistry::Get().Release(index);
+        }
+    }
+};
+
+thread_local ThreadSlot t_ThreadSlot;
+
+} // namespace
+
+uint32_t ThreadSlots::Current() {
+    if (t_ThreadSlot.index == UnassignedSlot) {
+        t_ThreadSlot.index = ThreadSlotRegistry::Get().Acquire();
+    }
+    return t_ThreadSlot.index;
+}
+
+} // namespace Yamen::Core
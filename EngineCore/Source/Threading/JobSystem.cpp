@@ -0,0 +1,287 @@
+#include "Core/Threading/JobSystem.h"
+#include "Core/Logging/Logger.h"
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace Yamen::Core {
+
+    /**
+     * @brief Shared state of one job in the graph
+     */
+    struct Job {
+        std::function<void()> work;
+        TaskPriority priority = TaskPriority::Normal;
+
+        // Unfinished prerequisites, plus one "hold" released by Submit()
+        std::atomic<uint32_t> remaining{ 1 };
+        std::atomic<bool> submitted{ false };
+        std::atomic<bool> completed{ false };
+        std::atomic<bool> failed{ false };
+
+        // Guards continuations against a concurrent completion
+        std::mutex mutex;
+        std::vector<std::shared_ptr<Job>> continuations;
+    };
+
+    namespace {
+
+        /**
+         * @brief Mark a job completed and collect the continuations it made ready
+         */
+        std::vector<std::shared_ptr<Job>> Complete(Job& job) {
+            std::vector<std::shared_ptr<Job>> continuations;
+            {
+                std::lock_guard<std::mutex> lock(job.mutex);
+                job.completed.store(true, std::memory_order_release);
+                continuations.swap(job.continuations);
+            }
+
+            std::vector<std::shared_ptr<Job>> ready;
+            for (auto& continuation : continuations) {
+                if (continuation->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    ready.push_back(std::move(continuation));
+                }
+            }
+            return ready;
+        }
+
+        /**
+         * @brief Complete a job that will never run, and every continuation it releases, as failed
+         *
+         * Nothing is enqueued: this runs while the pool is clearing its queues.
+         */
+        void Drop(std::shared_ptr<Job> job) noexcept {
+            std::vector<std::shared_ptr<Job>> dropped{ std::move(job) };
+            while (!dropped.empty()) {
+                std::shared_ptr<Job> next = std::move(dropped.back());
+                dropped.pop_back();
+
+                next->work = nullptr;
+                next->failed.store(true, std::memory_order_release);
+                for (auto& continuation : Complete(*next)) {
+                    dropped.push_back(std::move(continuation));
+                }
+            }
+        }
+
+    } // namespace
+
+    /**
+     * @brief Pool task body for a ready job
+     *
+     * If the pool destroys the task without running it (ClearPendingTasks), the job is
+     * dropped instead, so Wait() on it or on anything after it still returns.
+     */
+    class JobSystem::JobTask {
+    public:
+        JobTask(JobSystem& system, std::shared_ptr<Job> job)
+            : m_System(&system), m_Job(std::move(job)) {
+        }
+
+        JobTask(JobTask&& other) noexcept
+            : m_System(other.m_System)
+            , m_Job(std::move(other.m_Job))
+            , m_Pending(std::exchange(other.m_Pending, false)) {
+        }
+
+        JobTask(const JobTask&) = delete;
+        JobTask& operator=(const JobTask&) = delete;
+        JobTask& operator=(JobTask&&) = delete;
+
+        ~JobTask() {
+            if (m_Pending) {
+                Drop(std::move(m_Job));
+            }
+        }
+
+        void operator()() {
+            m_Pending = false;
+            m_System->Execute(m_Job);
+        }
+
+    private:
+        JobSystem* m_System;
+        std::shared_ptr<Job> m_Job;
+        bool m_Pending = true;
+    };
+
+    bool JobHandle::IsCompleted() const noexcept {
+        return !m_Job || m_Job->completed.load(std::memory_order_acquire);
+    }
+
+    bool JobHandle::HasFailed() const noexcept {
+        return m_Job && m_Job->failed.load(std::memory_order_acquire);
+    }
+
+    JobSystem::JobSystem(ThreadPool& threadPool)
+        : m_ThreadPool(threadPool) {
+    }
+
+    JobSystem::~JobSystem() = default;
+
+    JobHandle JobSystem::Create(std::function<void()> work, TaskPriority priority) {
+        auto job = std::make_shared<Job>();
+        job->work = std::move(work);
+        job->priority = priority;
+        return JobHandle(std::move(job));
+    }
+
+    void JobSystem::AddDependency(const JobHandle& job, const JobHandle& prerequisite) {
+        if (!job.IsValid() || !prerequisite.IsValid() || job.m_Job == prerequisite.m_Job) {
+            return;
+        }
+
+        if (job.m_Job->submitted.load(std::memory_order_acquire)) {
+            throw std::logic_error("AddDependency on a job that was already submitted");
+        }
+
+        Job& pre = *prerequisite.m_Job;
+        std::lock_guard<std::mutex> lock(pre.mutex);
+
+        if (pre.completed.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        job.m_Job->remaining.fetch_add(1, std::memory_order_relaxed);
+        pre.continuations.push_back(job.m_Job);
+    }
+
+    bool JobSystem::ReleaseHold(const std::shared_ptr<Job>& job) {
+        if (job->submitted.exchange(true, std::memory_order_acq_rel)) {
+            throw std::logic_error("Job submitted twice");
+        }
+
+        return job->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+
+    void JobSystem::Submit(const JobHandle& job) {
+        if (!job.IsValid()) {
+            return;
+        }
+
+        if (ReleaseHold(job.m_Job)) {
+            std::vector<std::shared_ptr<Job>> ready{ job.m_Job };
+            EnqueueReady(ready);
+        }
+    }
+
+    void JobSystem::SubmitBatch(std::span<const JobHandle> jobs) {
+        std::vector<std::shared_ptr<Job>> ready;
+        ready.reserve(jobs.size());
+
+        for (const auto& job : jobs) {
+            if (job.IsValid() && ReleaseHold(job.m_Job)) {
+                ready.push_back(job.m_Job);
+            }
+        }
+
+        EnqueueReady(ready);
+    }
+
+    JobHandle JobSystem::Schedule(std::function<void()> work,
+        std::span<const JobHandle> dependencies, TaskPriority priority) {
+
+        JobHandle job = Create(std::move(work), priority);
+        for (const auto& dependency : dependencies) {
+            AddDependency(job, dependency);
+        }
+        Submit(job);
+        return job;
+    }
+
+    JobHandle JobSystem::Then(const JobHandle& prerequisite, std::function<void()> work,
+        TaskPriority priority) {
+
+        JobHandle job = Create(std::move(work), priority);
+        AddDependency(job, prerequisite);
+        Submit(job);
+        return job;
+    }
+
+    JobHandle JobSystem::WhenAll(std::span<const JobHandle> jobs) {
+        return Schedule(nullptr, jobs, TaskPriority::Normal);
+    }
+
+    void JobSystem::Wait(const JobHandle& job) {
+        if (!job.IsValid()) {
+            return;
+        }
+
+        if (!job.m_Job->submitted.load(std::memory_order_acquire)) {
+            throw std::logic_error("Wait on a job that was never submitted");
+        }
+
+        // Help with pending work; only back off when there is nothing to run
+        int idleSpins = 0;
+        while (!job.IsCompleted()) {
+            if (m_ThreadPool.RunPendingTask()) {
+                idleSpins = 0;
+                continue;
+            }
+
+            if (++idleSpins < 64) {
+                std::this_thread::yield();
+            }
+            else {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+    }
+
+    void JobSystem::WaitAll(std::span<const JobHandle> jobs) {
+        for (const auto& job : jobs) {
+            Wait(job);
+        }
+    }
+
+    void JobSystem::Execute(const std::shared_ptr<Job>& job) {
+        try {
+            if (job->work) {
+                job->work();
+            }
+        }
+        catch (const std::exception& e) {
+            YAMEN_CORE_ERROR("Job threw exception: {}", e.what());
+            job->failed.store(true, std::memory_order_release);
+        }
+        catch (...) {
+            YAMEN_CORE_ERROR("Job threw unknown exception");
+            job->failed.store(true, std::memory_order_release);
+        }
+
+        // Drop captured state as soon as possible
+        job->work = nullptr;
+
+        std::vector<std::shared_ptr<Job>> ready = Complete(*job);
+        EnqueueReady(ready);
+    }
+
+    void JobSystem::EnqueueReady(std::vector<std::shared_ptr<Job>>& ready) {
+        if (ready.empty()) {
+            return;
+        }
+
+        if (ready.size() == 1) {
+            std::shared_ptr<Job> job = std::move(ready.front());
+            const TaskPriority priority = job->priority;
+            m_ThreadPool.EnqueueDetached(priority, JobTask(*this, std::move(job)));
+            return;
+        }
+
+        // One batch per priority level so the pool's ordering still applies
+        std::array<std::vector<TaskFunction>, 4> batches;
+        for (auto& job : ready) {
+            const size_t priority = static_cast<size_t>(job->priority);
+            batches[priority].emplace_back(JobTask(*this, std::move(job)));
+        }
+
+        for (size_t priority = batches.size(); priority-- > 0; ) {
+            m_ThreadPool.EnqueueBatchDetached(static_cast<TaskPriority>(priority), batches[priority]);
+        }
+    }
+
+} // namespace Yamen::Core
@@ -0,0 +1,60 @@
+#include "Core/Threading/LatencyHistogram.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Yamen::Core {
+
+    uint64_t HistogramSnapshot::Percentile(double percentile) const noexcept {
+        if (count == 0) {
+            return 0;
+        }
+
+        percentile = std::clamp(percentile, 0.0, 100.0);
+        const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * count)));
+
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BucketCount; ++i) {
+            seen += buckets[i];
+            if (seen >= rank) {
+                const uint64_t upper = i + 1 < BucketCount ? BucketLowerBound(i + 1) - 1 : max;
+                return std::min(upper, max);
+            }
+        }
+
+        return max;
+    }
+
+    void HistogramSnapshot::Merge(const HistogramSnapshot& other) noexcept {
+        for (size_t i = 0; i < BucketCount; ++i) {
+            buckets[i] += other.buckets[i];
+        }
+        count += other.count;
+        sum += other.sum;
+        max = std::max(max, other.max);
+    }
+
+    HistogramSnapshot LatencyHistogram::Snapshot() const noexcept {
+        HistogramSnapshot snapshot;
+        for (size_t i = 0; i < HistogramSnapshot::BucketCount; ++i) {
+            snapshot.buckets[i] = m_Buckets[i].load(std::memory_order_relaxed);
+        }
+
+        // Derive the count from the buckets so percentiles stay consistent with them
+        snapshot.count = 0;
+        for (uint64_t bucket : snapshot.buckets) {
+            snapshot.count += bucket;
+        }
+        snapshot.sum = m_Sum.load(std::memory_order_relaxed);
+        snapshot.max = m_Max.load(std::memory_order_relaxed);
+        return snapshot;
+    }
+
+    void LatencyHistogram::Reset() noexcept {
+        for (auto& bucket : m_Buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        m_Sum.store(0, std::memory_order_relaxed);
+        m_Max.store(0, std::memory_order_relaxed);
+    }
+
+} // namespace Yamen::Core
@@ -0,0 +1,48 @@
+#include "Core/Threading/MainThreadScheduler.h"
+#include "Core/Logging/Logger.h"
+#include <mutex>
+#include <vector>
+
+namespace Yamen::Core {
+
+    namespace {
+        std::mutex s_Mutex;
+        std::vector<std::coroutine_handle<>> s_Pending;
+        std::vector<std::coroutine_handle<>> s_Resuming;   // Main thread only; kept to reuse capacity
+    }
+
+    void MainThreadScheduler::Post(std::coroutine_handle<> handle) {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        s_Pending.push_back(handle);
+    }
+
+    size_t MainThreadScheduler::ProcessFrame() {
+        {
+            std::lock_guard<std::mutex> lock(s_Mutex);
+            if (s_Pending.empty()) {
+                return 0;
+            }
+            s_Resuming.swap(s_Pending);
+        }
+
+        // Task coroutines catch their own exceptions, but a raw awaiting coroutine may not
+        for (std::coroutine_handle<> handle : s_Resuming) {
+            try {
+                handle.resume();
+            }
+            catch (const std::exception& e) {
+                YAMEN_CORE_ERROR("Main thread continuation threw exception: {}", e.what());
+            }
+        }
+
+        const size_t resumed = s_Resuming.size();
+        s_Resuming.clear();
+        return resumed;
+    }
+
+    size_t MainThreadScheduler::GetPendingCount() {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        return s_Pending.size();
+    }
+
+} // namespace Yamen::Core
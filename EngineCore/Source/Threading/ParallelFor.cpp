@@ -0,0 +1,136 @@
+#include "Core/Threading/ParallelFor.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Yamen::Core {
+
+    size_t ComputeGrainSize(size_t count, size_t threadCount, size_t elementSize) {
+        threadCount = std::max<size_t>(threadCount, 1);
+
+        const size_t lineElements = elementSize > 0
+            ? std::max<size_t>(ParallelForSettings::CacheLineSize / elementSize, 1)
+            : 1;
+
+        size_t grain = count / (threadCount * ParallelForSettings::ChunksPerWorker);
+        grain = std::max(grain, lineElements);
+
+        // Whole cache lines per chunk
+        return (grain + lineElements - 1) / lineElements * lineElements;
+    }
+
+    namespace Detail {
+
+        namespace {
+            struct ParallelForState {
+                IndexRange range;
+                size_t grainSize = 1;
+                size_t chunkCount = 0;
+                ChunkInvoker invoker = nullptr;
+                void* context = nullptr;
+
+                std::atomic<size_t> nextChunk{ 0 };
+                std::atomic<size_t> activeHelpers{ 0 }; // Helpers inside RunChunks
+
+                std::mutex errorMutex;
+                std::exception_ptr error;
+            };
+
+            void RunChunks(ParallelForState& state) {
+                for (;;) {
+                    const size_t chunk = state.nextChunk.fetch_add(1, std::memory_order_relaxed);
+                    if (chunk >= state.chunkCount) {
+                        return;
+                    }
+
+                    const size_t begin = state.range.begin + chunk * state.grainSize;
+                    const size_t end = std::min(begin + state.grainSize, state.range.end);
+
+                    try {
+                        state.invoker(state.context, begin, end);
+                    }
+                    catch (...) {
+                        std::lock_guard<std::mutex> lock(state.errorMutex);
+                        if (!state.error) {
+                            state.error = std::current_exception();
+                        }
+                        // Stop handing out further chunks
+                        state.nextChunk.store(state.chunkCount, std::memory_order_relaxed);
+                    }
+                }
+            }
+        }
+
+        void ParallelForChunks(ThreadPool& pool, IndexRange range, size_t grainSize,
+            ChunkInvoker invoker, void* context) {
+
+            const size_t count = range.Size();
+            if (count == 0) {
+                return;
+            }
+
+            // An explicit grain size means the caller knows each element is expensive
+            const bool autoGrain = grainSize == 0;
+            if (autoGrain) {
+                grainSize = ComputeGrainSize(count, pool.GetThreadCount() + 1);
+            }
+
+            const size_t chunkCount = (count + grainSize - 1) / grainSize;
+
+            // Serial fallback: small ranges, a single chunk, or a pool that would never run helpers
+            if ((autoGrain && count < ParallelForSettings::SerialThreshold) || chunkCount <= 1 || pool.IsPaused()) {
+                invoker(context, range.begin, range.end);
+                return;
+            }
+
+            // Shared with the helpers: a helper may be dropped by ClearPendingTasks()
+            // or start only after this call has returned, so none of them can be
+            // waited for. Only helpers that are running chunks are.
+            auto state = std::make_shared<ParallelForState>();
+            state->range = range;
+            state->grainSize = grainSize;
+            state->chunkCount = chunkCount;
+            state->invoker = invoker;
+            state->context = context;
+
+            // The calling thread takes chunks too, so one fewer helper than chunks is enough
+            const size_t helperCount = std::min(chunkCount - 1, pool.GetThreadCount());
+
+            std::vector<TaskFunction> helpers;
+            helpers.reserve(helperCount);
+            for (size_t i = 0; i < helperCount; ++i) {
+                helpers.emplace_back([state] {
+                    // Counted before claiming a chunk, so the caller cannot miss a
+                    // helper that still runs one. A late helper claims nothing.
+                    state->activeHelpers.fetch_add(1);
+                    RunChunks(*state);
+                    state->activeHelpers.fetch_sub(1);
+                    });
+            }
+
+            try {
+                pool.EnqueueBatchDetached(TaskPriority::High, helpers);
+            }
+            catch (const std::exception&) {
+                // Pool is shutting down: nothing was enqueued, run everything here
+            }
+
+            RunChunks(*state);
+
+            // Every chunk is claimed; wait for the helpers still running theirs
+            while (state->activeHelpers.load() != 0) {
+                std::this_thread::yield();
+            }
+
+            if (state->error) {
+                std::rethrow_exception(state->error);
+            }
+        }
+
+    } // namespace Detail
+
+} // namespace Yamen::Core
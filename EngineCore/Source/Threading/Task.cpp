@@ -0,0 +1,12 @@
+#include "Core/Threading/Task.h"
+#include "Core/Utils/FileSystem.h"
+
+namespace Yamen::Core {
+
+    Task<std::vector<uint8_t>> ReadFileAsync(ThreadPool& pool, std::filesystem::path path, TaskPriority priority) {
+        // Blocking read, but on a worker at low priority instead of the caller's thread
+        co_await ResumeOn(pool, priority);
+        co_return FileSystem::ReadFile(path);
+    }
+
+} // namespace Yamen::Core
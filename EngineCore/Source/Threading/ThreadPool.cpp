@@ -1,5 +1,6 @@
 #include "Core/Threading/ThreadPool.h"
 #include "Core/Logging/Logger.h"
+#include <algorithm>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -9,6 +10,29 @@
 
 namespace Yamen::Core {
 
+    namespace {
+        // Identifies the pool (and worker slot) owning the current thread, so that
+        // tasks enqueued from inside a task can go straight to the local deque
+        thread_local ThreadPool* t_CurrentPool = nullptr;
+        thread_local size_t t_WorkerIndex = 0;
+
+        // Picks made by this thread, drives the anti-starvation rotation
+        thread_local uint32_t t_PickCount = 0;
+
+        // Token of the task running on this thread (innermost when tasks nest)
+        thread_local const CancellationToken* t_CurrentCancellation = nullptr;
+
+        uint64_t ToNanoseconds(std::chrono::steady_clock::duration duration) {
+            return static_cast<uint64_t>(std::max<int64_t>(0,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()));
+        }
+
+        const char* PriorityName(size_t priority) {
+            static const char* names[] = { "Low", "Normal", "High", "Critical" };
+            return priority < 4 ? names[priority] : "?";
+        }
+    }
+
     ThreadPool::ThreadPool(size_t numThreads, bool enableWorkStealing)
         : m_EnableWorkStealing(enableWorkStealing) {
 
@@ -20,6 +44,20 @@ namespace Yamen::Core {
         YAMEN_CORE_INFO("ThreadPool: Starting {} worker threads (work stealing: {})",
             numThreads, enableWorkStealing);
 
+        // Deques must exist before any worker can try to steal from them
+        if (m_EnableWorkStealing) {
+            m_WorkerQueues.reserve(numThreads);
+            for (size_t i = 0; i < numThreads; ++i) {
+                m_WorkerQueues.push_back(std::make_unique<WorkerQueues>());
+            }
+        }
+
+        // One stats slot per worker plus one shared by external threads
+        m_WorkerStats.reserve(numThreads + 1);
+        for (size_t i = 0; i <= numThreads; ++i) {
+            m_WorkerStats.push_back(std::make_unique<WorkerStats>());
+        }
+
         for (size_t i = 0; i < numThreads; ++i) {
             m_Workers.emplace_back([this, i] {
                 WorkerThread(i);
@@ -30,12 +68,9 @@ namespace Yamen::Core {
     ThreadPool::~ThreadPool() {
         YAMEN_CORE_INFO("ThreadPool: Shutting down...");
 
-        {
-            std::unique_lock<std::mutex> lock(m_QueueMutex);
-            m_Stop = true;
-        }
-
-        m_Condition.notify_all();
+        m_Stop = true;
+        m_WakeEpoch.fetch_add(1);
+        m_WakeEpoch.notify_all();
 
         for (std::thread& worker : m_Workers) {
             if (worker.joinable()) {
@@ -46,8 +81,134 @@ namespace Yamen::Core {
         YAMEN_CORE_INFO("ThreadPool: Shutdown complete. Stats:");
         YAMEN_CORE_INFO("  - Tasks completed: {}", m_Stats.tasksCompleted.load());
         YAMEN_CORE_INFO("  - Tasks failed: {}", m_Stats.tasksFailed.load());
+        YAMEN_CORE_INFO("  - Tasks cancelled: {}", m_Stats.tasksCancelled.load());
+        if (m_EnableWorkStealing) {
+            YAMEN_CORE_INFO("  - Tasks stolen: {}", m_Stats.tasksStolen.load());
+        }
         YAMEN_CORE_INFO("  - Uptime: {:.2f}s", m_Stats.GetUptime());
         YAMEN_CORE_INFO("  - Avg tasks/sec: {:.2f}", m_Stats.GetTasksPerSecond());
+
+        const StatsSnapshot snapshot = GetStatsSnapshot();
+        for (size_t priority = 0; priority < PriorityCount; ++priority) {
+            const HistogramSnapshot& wait = snapshot.queueWait[priority];
+            const HistogramSnapshot& run = snapshot.runTime[priority];
+            if (wait.count == 0) {
+                continue;
+            }
+
+            YAMEN_CORE_INFO("  - {} tasks: {}, wait p50/p99/max {:.3f}/{:.3f}/{:.3f}ms, run p50/p99 {:.3f}/{:.3f}ms",
+                PriorityName(priority), wait.count,
+                wait.Percentile(50) / 1e6, wait.Percentile(99) / 1e6, wait.max / 1e6,
+                run.Percentile(50) / 1e6, run.Percentile(99) / 1e6);
+        }
+    }
+
+    void ThreadPool::Submit(TaskWrapper&& task) {
+        if (m_Stop) {
+            throw std::runtime_error("Enqueue on stopped ThreadPool");
+        }
+
+        // Count before publishing so a consumer can never decrement below zero
+        m_PendingTasks++;
+        m_Stats.tasksEnqueued++;
+
+        // A worker enqueueing onto its own deque never touches shared state
+        if (m_EnableWorkStealing && t_CurrentPool == this) {
+            const size_t priority = static_cast<size_t>(task.priority);
+            m_WorkerQueues[t_WorkerIndex]->deques[priority].Push(SlabAllocator::New<TaskWrapper>(std::move(task)));
+        }
+        else {
+            PushShared(std::move(task));
+        }
+
+        WakeWorkers(1);
+    }
+
+    void ThreadPool::PushShared(TaskWrapper&& task) {
+        SharedQueue& queue = m_SharedQueues[static_cast<size_t>(task.priority)];
+
+        // While anything has spilled, later tasks queue behind it so consumers,
+        // which drain the ring first, still see them in submission order
+        if (queue.overflowCount.load(std::memory_order_acquire) == 0 && queue.ring.TryPush(std::move(task))) {
+            return;
+        }
+
+        // Ring full: spill rather than block the producer
+        std::lock_guard<std::mutex> lock(m_OverflowMutex);
+        queue.overflow.push_back(std::move(task));
+        queue.overflowCount++;
+    }
+
+    void ThreadPool::EnqueueBatchDetached(TaskPriority priority, std::vector<TaskFunction>& tasks) {
+        if (tasks.empty()) {
+            return;
+        }
+
+        if (m_Stop) {
+            throw std::runtime_error("Enqueue on stopped ThreadPool");
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        const auto noDeadline = std::chrono::steady_clock::time_point::max();
+
+        m_PendingTasks += tasks.size();
+        m_Stats.tasksEnqueued += tasks.size();
+
+        if (m_EnableWorkStealing && t_CurrentPool == this) {
+            auto& deque = m_WorkerQueues[t_WorkerIndex]->deques[static_cast<size_t>(priority)];
+            for (auto& task : tasks) {
+                deque.Push(SlabAllocator::New<TaskWrapper>(TaskWrapper{ priority, std::move(task), now, CancellationToken{}, noDeadline }));
+            }
+        }
+        else {
+            for (auto& task : tasks) {
+                PushShared(TaskWrapper{ priority, std::move(task), now, CancellationToken{}, noDeadline });
+            }
+        }
+
+        WakeWorkers(tasks.size());
+        tasks.clear();
+    }
+
+    bool ThreadPool::RunPendingTask() {
+        if (m_Paused) {
+            return false;
+        }
+
+        // External threads have no local deque; they take from the shared queues or steal
+        const size_t threadId = IsWorkerThread() ? t_WorkerIndex : m_Workers.size();
+        TaskWrapper taskWrapper;
+
+        if (!TryPopTask(threadId, taskWrapper)) {
+            return false;
+        }
+
+        ExecuteTask(threadId, taskWrapper);
+        return true;
+    }
+
+    bool ThreadPool::IsWorkerThread() const {
+        return t_CurrentPool == this;
+    }
+
+    bool ThreadPool::IsCurrentTaskCancelled() {
+        return t_CurrentCancellation && t_CurrentCancellation->IsCancellationRequested();
+    }
+
+    void ThreadPool::WakeWorkers(size_t count) {
+        // Pairs with the increment of m_SleepingWorkers in Park(): either the sleeper
+        // sees the new pending count, or we see the sleeper and bump the epoch it waits on
+        if (m_SleepingWorkers.load() == 0) {
+            return;
+        }
+
+        m_WakeEpoch.fetch_add(1);
+        if (count > 1) {
+            m_WakeEpoch.notify_all();
+        }
+        else {
+            m_WakeEpoch.notify_one();
+        }
     }
 
     void ThreadPool::WorkerThread(size_t threadId) {
@@ -56,43 +217,168 @@ namespace Yamen::Core {
 
         YAMEN_CORE_TRACE("Worker thread {} started", threadId);
 
+        t_CurrentPool = this;
+        t_WorkerIndex = threadId;
+
+        WorkerLoop(threadId);
+
+        t_CurrentPool = nullptr;
+
+        YAMEN_CORE_TRACE("Worker thread {} exiting", threadId);
+    }
+
+    void ThreadPool::WorkerLoop(size_t threadId) {
+        int idleSpins = 0;
+
         for (;;) {
             TaskWrapper taskWrapper;
 
-            {
-                std::unique_lock<std::mutex> lock(m_QueueMutex);
+            // Keep draining on shutdown even if paused
+            if ((!m_Paused || m_Stop) && TryPopTask(threadId, taskWrapper)) {
+                ExecuteTask(threadId, taskWrapper);
+                idleSpins = 0;
+                continue;
+            }
 
-                m_Condition.wait(lock, [this] {
-                    return m_Stop || (!m_Paused && !m_Tasks.empty());
-                    });
+            if (m_Stop && m_PendingTasks == 0) {
+                return;
+            }
 
-                if (m_Stop && m_Tasks.empty()) {
-                    YAMEN_CORE_TRACE("Worker thread {} exiting", threadId);
-                    return;
-                }
+            // Work that is counted but not yet visible (or just raced away) shows up
+            // within a few iterations, so spin briefly before paying for a park
+            if (++idleSpins < SpinCount) {
+                std::this_thread::yield();
+                continue;
+            }
 
-                if (m_Tasks.empty()) {
-                    continue;
-                }
+            Park(threadId);
+            idleSpins = 0;
+        }
+    }
+
+    void ThreadPool::Park(size_t threadId) {
+        const uint32_t epoch = m_WakeEpoch.load();
+
+        m_SleepingWorkers++;
+        if (!m_Stop && (m_Paused || m_PendingTasks == 0)) {
+            WorkerStats& stats = *m_WorkerStats[threadId];
+            const auto parkStart = std::chrono::steady_clock::now();
+            stats.parkedSince.store(parkStart.time_since_epoch().count(), std::memory_order_relaxed);
+
+            // Returns immediately if a producer bumped the epoch since we read it
+            m_WakeEpoch.wait(epoch);
+
+            stats.parkedSince.store(0, std::memory_order_relaxed);
+            stats.idleNanoseconds.fetch_add(
+                ToNanoseconds(std::chrono::steady_clock::now() - parkStart), std::memory_order_relaxed);
+        }
+        m_SleepingWorkers--;
+    }
+
+    bool ThreadPool::TryPopTask(size_t threadId, TaskWrapper& out) {
+        const uint32_t pick = t_PickCount++;
+
+        // Anti-starvation: periodically give one lower level the first shot
+        bool found = false;
+        if (pick % StarvationInterval == StarvationInterval - 1) {
+            const size_t boosted = (pick / StarvationInterval) % (PriorityCount - 1);
+            found = TryPopLevel(threadId, boosted, out);
+        }
+
+        // Otherwise strictly highest priority first
+        for (size_t level = PriorityCount; !found && level-- > 0; ) {
+            found = TryPopLevel(threadId, level, out);
+        }
+
+        if (!found) {
+            return false;
+        }
 
-                taskWrapper = std::move(const_cast<TaskWrapper&>(m_Tasks.top()));
-                m_Tasks.pop();
+        // Mark active before un-counting pending so WaitForAll never sees both at zero
+        m_ActiveTasks++;
+        m_PendingTasks--;
+        m_Stats.activeThreads++;
+        return true;
+    }
 
-                m_ActiveTasks++;
-                m_Stats.activeThreads++;
+    bool ThreadPool::TryPopLevel(size_t threadId, size_t level, TaskWrapper& out) {
+        // Prefer local work, then the shared queue (external submissions), then other
+        // workers' deques. threadId past the last worker means an external (helping) thread
+        if (threadId < m_WorkerQueues.size()) {
+            TaskWrapper* task = nullptr;
+            if (m_WorkerQueues[threadId]->deques[level].Pop(task)) {
+                out = std::move(*task);
+                SlabAllocator::Delete(task);
+                return true;
             }
+        }
 
-            // Calculate queue wait time
-            auto now = std::chrono::steady_clock::now();
-            auto waitTime = std::chrono::duration<double, std::milli>(
-                now - taskWrapper.enqueueTime
-            ).count();
+        return TryPopShared(level, out) || TrySteal(threadId, level, out);
+    }
 
-            if (waitTime > 100.0) { // Log if task waited >100ms
-                YAMEN_CORE_WARN("Task waited {:.2f}ms in queue (priority: {})",
-                    waitTime, static_cast<int>(taskWrapper.priority));
+    bool ThreadPool::TryPopShared(size_t level, TaskWrapper& out) {
+        SharedQueue& queue = m_SharedQueues[level];
+
+        if (queue.ring.TryPop(out)) {
+            return true;
+        }
+
+        if (queue.overflowCount.load(std::memory_order_relaxed) == 0) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(m_OverflowMutex);
+
+        if (queue.overflow.empty()) {
+            return false;
+        }
+
+        out = std::move(queue.overflow.front());
+        queue.overflow.pop_front();
+        queue.overflowCount--;
+        return true;
+    }
+
+    bool ThreadPool::TrySteal(size_t thiefId, size_t priority, TaskWrapper& out) {
+        const size_t workerCount = m_WorkerQueues.size();
+
+        for (size_t offset = 1; offset <= workerCount; ++offset) {
+            const size_t victim = (thiefId + offset) % workerCount;
+            if (victim == thiefId) {
+                continue;
             }
 
+            TaskWrapper* task = nullptr;
+
+            if (m_WorkerQueues[victim]->deques[priority].Steal(task)) {
+                out = std::move(*task);
+                SlabAllocator::Delete(task);
+                m_Stats.tasksStolen++;
+                m_WorkerStats[thiefId]->tasksStolen.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void ThreadPool::ExecuteTask(size_t threadId, TaskWrapper& taskWrapper) {
+        // Record into this thread's own counters; no logging on the dispatch path
+        WorkerStats& stats = *m_WorkerStats[threadId];
+        const size_t priority = static_cast<size_t>(taskWrapper.priority);
+
+        const auto start = std::chrono::steady_clock::now();
+        stats.queueWait[priority].Record(ToNanoseconds(start - taskWrapper.enqueueTime));
+
+        if (taskWrapper.cancellation.IsCancellationRequested() || start > taskWrapper.deadline) {
+            // Drop without running; destroying the task completes an Enqueue future with TaskCancelledError
+            taskWrapper.task = nullptr;
+            m_Stats.tasksCancelled++;
+        }
+        else {
+            const CancellationToken* outerCancellation = t_CurrentCancellation;
+            t_CurrentCancellation = &taskWrapper.cancellation;
+
             // Execute task with exception safety
             try {
                 taskWrapper.task();
@@ -107,12 +393,22 @@ namespace Yamen::Core {
                 m_Stats.tasksFailed++;
             }
 
+            t_CurrentCancellation = outerCancellation;
+
+            const uint64_t runTime = ToNanoseconds(std::chrono::steady_clock::now() - start);
+            stats.runTime[priority].Record(runTime);
+            stats.busyNanoseconds.fetch_add(runTime, std::memory_order_relaxed);
+            stats.tasksExecuted.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        m_ActiveTasks--;
+        m_Stats.activeThreads--;
+
+        // Only touch the lock when someone is blocked in WaitForAll (pairs with m_WaitingThreads++)
+        if (m_WaitingThreads.load() > 0) {
             {
-                std::unique_lock<std::mutex> lock(m_QueueMutex);
-                m_ActiveTasks--;
-                m_Stats.activeThreads--;
+                std::lock_guard<std::mutex> lock(m_WaitMutex);
             }
-
             m_WaitCondition.notify_all();
         }
     }
@@ -133,35 +429,114 @@ namespace Yamen::Core {
     }
 
     bool ThreadPool::WaitForAll(std::chrono::milliseconds timeout) {
-        std::unique_lock<std::mutex> lock(m_QueueMutex);
+        std::unique_lock<std::mutex> lock(m_WaitMutex);
+
+        auto isIdle = [this] {
+            return m_PendingTasks == 0 && m_ActiveTasks == 0;
+            };
 
+        m_WaitingThreads++;
+
+        bool idle = true;
         if (timeout.count() == 0) {
             // Wait indefinitely
-            m_WaitCondition.wait(lock, [this] {
-                return m_Tasks.empty() && m_ActiveTasks == 0;
-                });
-            return true;
+            m_WaitCondition.wait(lock, isIdle);
         }
         else {
             // Wait with timeout
-            return m_WaitCondition.wait_for(lock, timeout, [this] {
-                return m_Tasks.empty() && m_ActiveTasks == 0;
-                });
+            idle = m_WaitCondition.wait_for(lock, timeout, isIdle);
+        }
+
+        m_WaitingThreads--;
+        return idle;
+    }
+
+    ThreadPool::StatsSnapshot ThreadPool::GetStatsSnapshot() const {
+        StatsSnapshot snapshot;
+        snapshot.uptime = m_Stats.GetUptime();
+        snapshot.workers.reserve(m_WorkerStats.size());
+
+        const auto now = std::chrono::steady_clock::now();
+
+        for (const auto& stats : m_WorkerStats) {
+            for (size_t priority = 0; priority < PriorityCount; ++priority) {
+                snapshot.queueWait[priority].Merge(stats->queueWait[priority].Snapshot());
+                snapshot.runTime[priority].Merge(stats->runTime[priority].Snapshot());
+            }
+
+            WorkerStatsSnapshot worker;
+            worker.tasksExecuted = stats->tasksExecuted.load(std::memory_order_relaxed);
+            worker.tasksStolen = stats->tasksStolen.load(std::memory_order_relaxed);
+            worker.busySeconds = stats->busyNanoseconds.load(std::memory_order_relaxed) / 1e9;
+            uint64_t idle = stats->idleNanoseconds.load(std::memory_order_relaxed);
+
+            // Include the park in progress, or an idle worker reads as never idle
+            const int64_t parkedSince = stats->parkedSince.load(std::memory_order_relaxed);
+            if (parkedSince != 0) {
+                idle += ToNanoseconds(now - std::chrono::steady_clock::time_point(
+                    std::chrono::steady_clock::duration(parkedSince)));
+            }
+            worker.idleSeconds = idle / 1e9;
+            snapshot.workers.push_back(worker);
+        }
+
+        return snapshot;
+    }
+
+    void ThreadPool::ResetStatsSnapshot() {
+        for (auto& stats : m_WorkerStats) {
+            for (size_t priority = 0; priority < PriorityCount; ++priority) {
+                stats->queueWait[priority].Reset();
+                stats->runTime[priority].Reset();
+            }
+            stats->tasksExecuted.store(0, std::memory_order_relaxed);
+            stats->tasksStolen.store(0, std::memory_order_relaxed);
+            stats->busyNanoseconds.store(0, std::memory_order_relaxed);
+            stats->idleNanoseconds.store(0, std::memory_order_relaxed);
         }
     }
 
     size_t ThreadPool::GetPendingTaskCount() const {
-        std::unique_lock<std::mutex> lock(m_QueueMutex);
-        return m_Tasks.size();
+        return m_PendingTasks.load();
     }
 
     void ThreadPool::ClearPendingTasks() {
-        std::unique_lock<std::mutex> lock(m_QueueMutex);
+        size_t cleared = 0;
+
+        {
+            std::lock_guard<std::mutex> lock(m_OverflowMutex);
+
+            for (auto& queue : m_SharedQueues) {
+                TaskWrapper task;
+                while (queue.ring.TryPop(task)) {
+                    cleared++;
+                }
 
-        size_t cleared = m_Tasks.size();
-        while (!m_Tasks.empty()) {
-            m_Tasks.pop();
+                cleared += queue.overflow.size();
+                queue.overflow.clear();
+                queue.overflowCount = 0;
+            }
+        }
+
+        // Stealing is safe from any thread, so drain every deque from the top
+        for (auto& queues : m_WorkerQueues) {
+            for (auto& deque : queues->deques) {
+                TaskWrapper* task = nullptr;
+                while (!deque.Empty()) {
+                    if (deque.Steal(task)) {
+                        SlabAllocator::Delete(task);
+                        cleared++;
+                    }
+                }
+            }
+        }
+
+        m_PendingTasks -= cleared;
+
+        {
+            std::lock_guard<std::mutex> lock(m_WaitMutex);
         }
+        m_WaitCondition.notify_all();
 
         YAMEN_CORE_INFO("ThreadPool: Cleared {} pending tasks", cleared);
     }
@@ -173,7 +548,8 @@ namespace Yamen::Core {
 
     void ThreadPool::Resume() {
         m_Paused = false;
-        m_Condition.notify_all();
+        m_WakeEpoch.fetch_add(1);
+        m_WakeEpoch.notify_all();
         YAMEN_CORE_INFO("ThreadPool: Resumed");
     }
 
@@ -0,0 +1,41 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Yamen::Tools {
+
+    /**
+     * @brief Configuration for the SIMD math benchmark
+     */
+    struct SimdMathBenchmarkConfig {
+        size_t elementCount = 100000;   // vec3 per batch (stays cache-resident at the default)
+        int iterations = 50;            // Batches per measurement
+        int repetitions = 3;            // Best-of-N timing
+    };
+
+    /**
+     * @brief One measurement: a kernel on one path
+     */
+    struct SimdMathBenchmarkResult {
+        std::string kernel;
+        std::string path;               // "vec3" wrapper loop or the simd backend name
+        double milliseconds = 0.0;
+        double elementsPerSecond = 0.0;
+    };
+
+    /**
+     * @brief Compare per-element Math.h wrapper loops against the simd batch kernels
+     *
+     * Runs point transform, normalize, cross and quaternion rotate over the same
+     * data both ways and reports the best time of each.
+     */
+    std::vector<SimdMathBenchmarkResult> RunSimdMathBenchmark(
+        const SimdMathBenchmarkConfig& config = {});
+
+    /**
+     * @brief Print benchmark results as a table through the core logger
+     */
+    void LogSimdMathBenchmarkResults(const std::vector<SimdMathBenchmarkResult>& results);
+
+} // namespace Yamen::Tools
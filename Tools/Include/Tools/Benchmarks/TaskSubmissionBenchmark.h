@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Yamen::Tools {
+
+    /**
+     * @brief Configuration for the task submission benchmark
+     */
+    struct TaskSubmissionBenchmarkConfig {
+        size_t threadCount = 4;
+        size_t taskCount = 200000;      // Tiny tasks submitted per measurement
+        int repetitions = 3;            // Best-of-N timing
+    };
+
+    /**
+     * @brief One measurement: a submission path
+     */
+    struct TaskSubmissionBenchmarkResult {
+        std::string path;
+        double milliseconds = 0.0;
+        double tasksPerSecond = 0.0;
+        size_t slabsReserved = 0;       // SlabAllocator slabs in use after the run
+    };
+
+    /**
+     * @brief Measure per-task submission overhead of the ThreadPool
+     *
+     * Compares the old submission shape (packaged_task in a shared_ptr wrapped in
+     * std::function, one heap allocation each) with EnqueueDetached and the
+     * future-returning Enqueue on the slab-backed path.
+     */
+    std::vector<TaskSubmissionBenchmarkResult> RunTaskSubmissionBenchmark(
+        const TaskSubmissionBenchmarkConfig& config = {});
+
+    /**
+     * @brief Print benchmark results as a table through the core logger
+     */
+    void LogTaskSubmissionBenchmarkResults(const std::vector<TaskSubmissionBenchmarkResult>& results);
+
+} // namespace Yamen::Tools
@@ -0,0 +1,48 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Yamen::Tools {
+
+    /**
+     * @brief Configuration for the ThreadPool contention benchmark
+     */
+    struct ThreadPoolBenchmarkConfig {
+        std::vector<size_t> threadCounts{ 1, 2, 4, 8, 16, 32, 64 };
+        size_t rootTasks = 256;         // Tasks enqueued from the calling thread
+        size_t childrenPerRoot = 256;   // Tasks each root enqueues from inside the pool
+        size_t workPerTask = 64;        // Spin iterations per task (keeps tasks tiny)
+        int repetitions = 3;            // Best-of-N timing
+    };
+
+    /**
+     * @brief One measurement: a thread count in one scheduling mode
+     */
+    struct ThreadPoolBenchmarkResult {
+        size_t threadCount = 0;
+        bool workStealing = false;
+        uint64_t tasksExecuted = 0;
+        uint64_t tasksStolen = 0;
+        double milliseconds = 0.0;
+        double tasksPerSecond = 0.0;
+    };
+
+    /**
+     * @brief Measure scheduler contention with the shared rings vs. work stealing
+     *
+     * Each root task fans out into many tiny child tasks enqueued from worker
+     * threads. Without work stealing every push and pop goes through the shared
+     * lock-free MPMC ring of its priority, so all workers contend on the same
+     * head/tail counters; with work stealing a worker pushes onto its own deque
+     * and only touches other workers' deques to steal.
+     */
+    std::vector<ThreadPoolBenchmarkResult> RunThreadPoolContentionBenchmark(
+        const ThreadPoolBenchmarkConfig& config = {});
+
+    /**
+     * @brief Print benchmark results as a table through the core logger
+     */
+    void LogThreadPoolBenchmarkResults(const std::vector<ThreadPoolBenchmarkResult>& results);
+
+} // namespace Yamen::Tools
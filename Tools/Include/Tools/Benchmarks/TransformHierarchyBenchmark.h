@@ -0,0 +1,46 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Yamen::Tools {
+
+    /**
+     * @brief Configuration for the transform hierarchy benchmark
+     */
+    struct TransformHierarchyBenchmarkConfig {
+        size_t nodeCount = 100000;      // Roots and children
+        uint32_t maxDepth = 8;          // Trees get a random depth in [1, maxDepth]
+        size_t rootCount = 2000;
+        float dirtyFraction = 0.01f;    // Share of nodes moved per frame in the partial case
+        size_t threadCount = 4;         // 0 = serial only
+        int frames = 20;                // Frames per measurement
+        int repetitions = 3;            // Best-of-N timing
+    };
+
+    /**
+     * @brief One measurement: a workload on one path
+     */
+    struct TransformHierarchyBenchmarkResult {
+        std::string workload;
+        std::string path;               // "serial" or "pool"
+        double millisecondsPerFrame = 0.0;
+        size_t matricesPerFrame = 0;    // World matrices recomputed per frame
+    };
+
+    /**
+     * @brief Measure TransformSystem + TransformHierarchySystem over a mixed-depth forest
+     *
+     * Workloads: every node moved, roots only moved (whole subtrees dirty), a
+     * small random share moved, and nothing moved.
+     */
+    std::vector<TransformHierarchyBenchmarkResult> RunTransformHierarchyBenchmark(
+        const TransformHierarchyBenchmarkConfig& config = {});
+
+    /**
+     * @brief Print benchmark results as a table through the core logger
+     */
+    void LogTransformHierarchyBenchmarkResults(const std::vector<TransformHierarchyBenchmarkResult>& results);
+
+} // namespace Yamen::Tools
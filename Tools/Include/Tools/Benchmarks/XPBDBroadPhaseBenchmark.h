@@ -0,0 +1,51 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Yamen::Tools {
+
+    /**
+     * @brief Configuration for the XPBD broad phase benchmark
+     */
+    struct XPBDBroadPhaseBenchmarkConfig {
+        std::vector<size_t> particleCounts = { 1000, 10000 };
+        float particleRadius = 0.25f;
+        float fillFraction = 0.05f;     // Share of the box volume taken by particles
+        size_t allPairsMaxCount = 10000; // Larger scenes skip the O(N^2) reference
+        bool groundCollider = true;     // Static ground box under the particles
+        float groundHalfSize = 25.0f;   // Minimum half-width of the ground box
+        int frames = 10;                // Frames per measurement
+        int repetitions = 3;            // Best-of-N timing
+    };
+
+    /**
+     * @brief One measurement: a particle count on one broad phase
+     */
+    struct XPBDBroadPhaseBenchmarkResult {
+        size_t particleCount = 0;
+        std::string broadPhase;         // "all pairs" or "spatial hash"
+        double millisecondsPerFrame = 0.0;  // Whole solver step
+        double collisionMilliseconds = 0.0; // Broad + narrow phase, last substep
+        size_t candidatePairs = 0;      // Pairs handed to the narrow phase, last substep
+        size_t contacts = 0;
+        bool matchesAllPairs = true;    // Same contacts as the all-pairs run of this count
+    };
+
+    /**
+     * @brief Step XPBDSolver over a box of falling spheres with each broad phase
+     *
+     * A wide static ground box sits under the spheres, as in XPBDTestScene, so
+     * the spatial hash is measured with one collider far larger than the rest.
+     * The same seeded scene is built for every run, so both broad phases see
+     * identical work and must report the same contact count.
+     */
+    std::vector<XPBDBroadPhaseBenchmarkResult> RunXPBDBroadPhaseBenchmark(
+        const XPBDBroadPhaseBenchmarkConfig& config = {});
+
+    /**
+     * @brief Print benchmark results as a table through the core logger
+     */
+    void LogXPBDBroadPhaseBenchmarkResults(const std::vector<XPBDBroadPhaseBenchmarkResult>& results);
+
+} // namespace Yamen::Tools
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Yamen::Tools {
+
+    /**
+     * @brief Configuration for the XPBD particle store benchmark
+     */
+    struct XPBDParticleStoreBenchmarkConfig {
+        std::vector<size_t> clothSizes = { 32, 96 }; // Particles per cloth edge
+        size_t sphereCount = 500;       // Falling spheres colliding with the cloth
+        bool parallelSolve = true;      // Also compare the paths with ParallelSolve
+        size_t threadCount = 4;         // Workers for the parallel runs
+        int frames = 10;                // Frames per measurement
+        int repetitions = 3;            // Best-of-N timing
+    };
+
+    /**
+     * @brief One measurement: a cloth size on one particle access path
+     */
+    struct XPBDParticleStoreBenchmarkResult {
+        size_t particleCount = 0;
+        size_t constraintCount = 0;
+        std::string path;               // "components" or "particle store"
+        std::string solve;              // "serial", "parallel" or "jacobi" (no contact colours)
+        double millisecondsPerFrame = 0.0;
+        bool matchesComponents = true;  // Final state bitwise equal to the component path
+    };
+
+    /**
+     * @brief Step XPBDSolver over a pinned cloth and a shower of spheres with and without UseParticleStore
+     *
+     * Both paths start from the same seeded scene. After the last frame every
+     * particle's position, previous position, velocity and sleep state and every
+     * constraint's lambda are compared bitwise with the component path.
+     *
+     * With parallelSolve the pair is run again with ParallelSolve, once with
+     * coloured contacts and once with MaxContactColors = 0 so every contact
+     * takes the Jacobi path.
+     */
+    std::vector<XPBDParticleStoreBenchmarkResult> RunXPBDParticleStoreBenchmark(
+        const XPBDParticleStoreBenchmarkConfig& config = {});
+
+    /**
+     * @brief Print benchmark results as a table through the core logger
+     */
+    void LogXPBDParticleStoreBenchmarkResults(const std::vector<XPBDParticleStoreBenchmarkResult>& results);
+
+} // namespace Yamen::Tools
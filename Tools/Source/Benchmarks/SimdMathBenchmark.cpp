@@ -0,0 +1,132 @@
+#include "Tools/Benchmarks/SimdMathBenchmark.h"
+#include <Core/Logging/Logger.h>
+#include <Core/Math/SIMDMath.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+namespace Yamen::Tools {
+
+    namespace {
+
+        template<typename BatchFn>
+        SimdMathBenchmarkResult Measure(const SimdMathBenchmarkConfig& config,
+            const char* kernel, const char* path, BatchFn&& batch) {
+
+            SimdMathBenchmarkResult result;
+            result.kernel = kernel;
+            result.path = path;
+
+            for (int rep = 0; rep < std::max(config.repetitions, 1); ++rep) {
+                auto start = std::chrono::steady_clock::now();
+
+                for (int i = 0; i < config.iterations; ++i) {
+                    batch();
+                }
+
+                double ms = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - start).count();
+
+                if (rep == 0 || ms < result.milliseconds) {
+                    result.milliseconds = ms;
+                }
+            }
+
+            const double elements = static_cast<double>(config.elementCount) * config.iterations;
+            result.elementsPerSecond = result.milliseconds > 0.0
+                ? elements / (result.milliseconds / 1000.0)
+                : 0.0;
+            return result;
+        }
+
+    } // namespace
+
+    std::vector<SimdMathBenchmarkResult> RunSimdMathBenchmark(
+        const SimdMathBenchmarkConfig& config) {
+
+        using Core::vec3;
+        using Core::quat;
+        using Core::mat4;
+
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+
+        std::vector<vec3> a(config.elementCount);
+        std::vector<vec3> b(config.elementCount);
+        std::vector<quat> rotations(config.elementCount);
+        std::vector<vec3> out(config.elementCount);
+        for (size_t i = 0; i < config.elementCount; ++i) {
+            a[i] = vec3(dist(rng), dist(rng), dist(rng));
+            b[i] = vec3(dist(rng), dist(rng), dist(rng));
+            rotations[i] = Core::Math::AngleAxis(dist(rng), Core::Math::Normalize(b[i]));
+        }
+
+        const mat4 transform = Core::Math::Scale(
+            Core::Math::Rotate(Core::Math::Translate(vec3(1.0f, 2.0f, 3.0f)), 0.5f, vec3(0.0f, 1.0f, 0.0f)),
+            vec3(2.0f));
+        const quat rotation = Core::Math::AngleAxis(0.5f, vec3(0.0f, 1.0f, 0.0f));
+        const char* simd = Core::simd::BackendName;
+
+        std::vector<SimdMathBenchmarkResult> results;
+
+        results.push_back(Measure(config, "TransformPoints", "vec3", [&] {
+            for (size_t i = 0; i < a.size(); ++i) {
+                const Core::vec4 p = transform * Core::vec4(a[i], 1.0f);
+                out[i] = vec3(p.x, p.y, p.z);
+            }
+            }));
+        results.push_back(Measure(config, "TransformPoints", simd, [&] {
+            Core::simd::TransformPoints(transform, a, out);
+            }));
+
+        results.push_back(Measure(config, "Normalize", "vec3", [&] {
+            for (size_t i = 0; i < a.size(); ++i) {
+                out[i] = Core::Math::Normalize(a[i]);
+            }
+            }));
+        results.push_back(Measure(config, "Normalize", simd, [&] {
+            Core::simd::Normalize(a, out);
+            }));
+
+        results.push_back(Measure(config, "Cross", "vec3", [&] {
+            for (size_t i = 0; i < a.size(); ++i) {
+                out[i] = Core::Math::Cross(a[i], b[i]);
+            }
+            }));
+        results.push_back(Measure(config, "Cross", simd, [&] {
+            Core::simd::Cross(a, b, out);
+            }));
+
+        results.push_back(Measure(config, "Rotate", "vec3", [&] {
+            for (size_t i = 0; i < a.size(); ++i) {
+                out[i] = Core::Math::Rotate(rotation, a[i]);
+            }
+            }));
+        results.push_back(Measure(config, "Rotate", simd, [&] {
+            Core::simd::Rotate(rotation, a, out);
+            }));
+
+        results.push_back(Measure(config, "Rotate (per element)", "vec3", [&] {
+            for (size_t i = 0; i < a.size(); ++i) {
+                out[i] = Core::Math::Rotate(rotations[i], a[i]);
+            }
+            }));
+        results.push_back(Measure(config, "Rotate (per element)", simd, [&] {
+            Core::simd::Rotate(rotations, a, out);
+            }));
+
+        return results;
+    }
+
+    void LogSimdMathBenchmarkResults(const std::vector<SimdMathBenchmarkResult>& results) {
+        YAMEN_CORE_INFO("SIMD math benchmark");
+        YAMEN_CORE_INFO("  {:>20} | {:>6} | {:>10} | {:>14}",
+            "kernel", "path", "time (ms)", "elements/sec");
+
+        for (const auto& r : results) {
+            YAMEN_CORE_INFO("  {:>20} | {:>6} | {:>10.2f} | {:>14.0f}",
+                r.kernel, r.path, r.milliseconds, r.elementsPerSecond);
+        }
+    }
+
+} // namespace Yamen::Tools
@@ -0,0 +1,90 @@
+#include "Tools/Benchmarks/ThreadPoolBenchmark.h"
+#include <Core/Logging/Logger.h>
+#include <Core/Threading/ThreadPool.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
+namespace Yamen::Tools {
+
+    namespace {
+
+        void SpinWork(size_t iterations, std::atomic<uint64_t>& sink) {
+            uint64_t value = iterations;
+            for (size_t i = 0; i < iterations; ++i) {
+                value = value * 6364136223846793005ull + 1442695040888963407ull;
+            }
+            sink.fetch_add(value & 1, std::memory_order_relaxed);
+        }
+
+        ThreadPoolBenchmarkResult RunOnce(const ThreadPoolBenchmarkConfig& config,
+            size_t threadCount, bool workStealing) {
+
+            ThreadPoolBenchmarkResult result;
+            result.threadCount = threadCount;
+            result.workStealing = workStealing;
+            result.milliseconds = 0.0;
+
+            for (int rep = 0; rep < std::max(config.repetitions, 1); ++rep) {
+                Core::ThreadPool pool(threadCount, workStealing);
+                std::atomic<uint64_t> sink{ 0 };
+
+                auto start = std::chrono::steady_clock::now();
+
+                for (size_t r = 0; r < config.rootTasks; ++r) {
+                    pool.EnqueueDetached(Core::TaskPriority::Normal, [&pool, &sink, &config] {
+                        for (size_t c = 0; c < config.childrenPerRoot; ++c) {
+                            pool.EnqueueDetached(Core::TaskPriority::Normal, [&sink, &config] {
+                                SpinWork(config.workPerTask, sink);
+                                });
+                        }
+                        });
+                }
+
+                pool.WaitForAll();
+
+                double ms = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - start).count();
+
+                if (rep == 0 || ms < result.milliseconds) {
+                    result.milliseconds = ms;
+                    result.tasksExecuted = pool.GetStats().tasksCompleted.load();
+                    result.tasksStolen = pool.GetStats().tasksStolen.load();
+                }
+            }
+
+            result.tasksPerSecond = result.milliseconds > 0.0
+                ? result.tasksExecuted / (result.milliseconds / 1000.0)
+                : 0.0;
+            return result;
+        }
+
+    } // namespace
+
+    std::vector<ThreadPoolBenchmarkResult> RunThreadPoolContentionBenchmark(
+        const ThreadPoolBenchmarkConfig& config) {
+
+        std::vector<ThreadPoolBenchmarkResult> results;
+        results.reserve(config.threadCounts.size() * 2);
+
+        for (size_t threads : config.threadCounts) {
+            results.push_back(RunOnce(config, threads, false));
+            results.push_back(RunOnce(config, threads, true));
+        }
+
+        return results;
+    }
+
+    void LogThreadPoolBenchmarkResults(const std::vector<ThreadPoolBenchmarkResult>& results) {
+        YAMEN_CORE_INFO("ThreadPool contention benchmark");
+        YAMEN_CORE_INFO("  {:>7} | {:>13} | {:>10} | {:>14} | {:>10}",
+            "threads", "mode", "time (ms)", "tasks/sec", "stolen");
+
+        for (const auto& r : results) {
+            YAMEN_CORE_INFO("  {:>7} | {:>13} | {:>10.2f} | {:>14.0f} | {:>10}",
+                r.threadCount, r.workStealing ? "work-stealing" : "shared-rings",
+                r.milliseconds, r.tasksPerSecond, r.tasksStolen);
+        }
+    }
+
+} // namespace Yamen::Tools
@@ -0,0 +1,180 @@
+#include "Tools/Benchmarks/TransformHierarchyBenchmark.h"
+#include <Core/Logging/Logger.h>
+#include <Core/Threading/ThreadPool.h>
+#include <ECS/Components/CoreComponents.h>
+#include <ECS/Scene.h>
+#include <ECS/Systems/TransformHierarchySystem.h>
+#include <ECS/Systems/TransformSystem.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <random>
+
+namespace Yamen::Tools {
+
+    namespace {
+
+        using ECS::HierarchyComponent;
+        using ECS::TransformComponent;
+
+        // Forest of config.rootCount trees with random depth and fan-out
+        std::vector<entt::entity> BuildForest(ECS::Scene& scene, const TransformHierarchyBenchmarkConfig& config,
+            std::vector<entt::entity>& roots) {
+
+            auto& registry = scene.Registry();
+            std::mt19937 rng(42);
+            std::uniform_real_distribution<float> offset(-1.0f, 1.0f);
+
+            std::vector<entt::entity> nodes;
+            nodes.reserve(config.nodeCount);
+
+            auto create = [&](entt::entity parent) {
+                entt::entity entity = registry.create();
+                auto& transform = registry.emplace<TransformComponent>(entity);
+                transform.Translation = Core::vec3(offset(rng), offset(rng), offset(rng));
+                if (parent != entt::null) {
+                    registry.emplace<HierarchyComponent>(entity).Parent = parent;
+                    registry.get<HierarchyComponent>(parent).Children.push_back(entity);
+                }
+                else {
+                    registry.emplace<HierarchyComponent>(entity);
+                }
+                nodes.push_back(entity);
+                return entity;
+            };
+
+            const size_t rootCount = std::clamp<size_t>(config.rootCount, 1, config.nodeCount);
+            const uint32_t maxDepth = std::max<uint32_t>(config.maxDepth, 1);
+            const size_t perTree = config.nodeCount / rootCount;
+
+            for (size_t r = 0; r < rootCount; ++r) {
+                roots.push_back(create(entt::null));
+
+                // Grow level by level until the tree has its share of nodes or hits its depth
+                const uint32_t depth = 1 + rng() % maxDepth;
+                const size_t budget = (r + 1 == rootCount ? config.nodeCount - nodes.size() : perTree - 1);
+                std::vector<entt::entity> level{ roots.back() };
+                size_t created = 0;
+
+                for (uint32_t d = 0; d < depth && created < budget && !level.empty(); ++d) {
+                    const size_t remainingLevels = depth - d;
+                    const size_t levelBudget = std::max<size_t>((budget - created) / remainingLevels, level.size());
+                    std::vector<entt::entity> next;
+
+                    for (size_t i = 0; i < levelBudget && created < budget; ++i) {
+                        next.push_back(create(level[i % level.size()]));
+                        ++created;
+                    }
+                    level = std::move(next);
+                }
+            }
+            return nodes;
+        }
+
+        template<typename MutateFn>
+        TransformHierarchyBenchmarkResult Measure(const TransformHierarchyBenchmarkConfig& config,
+            const char* workload, Core::ThreadPool* pool, MutateFn&& mutate) {
+
+            TransformHierarchyBenchmarkResult result;
+            result.workload = workload;
+            result.path = pool ? "pool" : "serial";
+
+            for (int rep = 0; rep < std::max(config.repetitions, 1); ++rep) {
+                ECS::Scene scene("TransformHierarchyBenchmark");
+                scene.SetThreadPool(pool);
+
+                std::vector<entt::entity> roots;
+                std::vector<entt::entity> nodes = BuildForest(scene, config, roots);
+
+                ECS::TransformHierarchySystem hierarchy;
+                ECS::TransformSystem::UpdateWorldMatrices(&scene);
+                hierarchy.Propagate(&scene);
+
+                size_t updated = 0;
+                auto start = std::chrono::steady_clock::now();
+
+                for (int frame = 0; frame < config.frames; ++frame) {
+                    mutate(scene.Registry(), nodes, roots, frame);
+                    ECS::TransformSystem::UpdateWorldMatrices(&scene);
+                    updated += hierarchy.Propagate(&scene);
+                }
+
+                double ms = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - start).count() / std::max(config.frames, 1);
+
+                if (rep == 0 || ms < result.millisecondsPerFrame) {
+                    result.millisecondsPerFrame = ms;
+                    result.matricesPerFrame = updated / std::max(config.frames, 1);
+                }
+            }
+            return result;
+        }
+
+        void Move(entt::registry& registry, entt::entity entity, int frame) {
+            registry.get<TransformComponent>(entity).Translation.y = 0.01f * static_cast<float>(frame + 1);
+        }
+
+    } // namespace
+
+    std::vector<TransformHierarchyBenchmarkResult> RunTransformHierarchyBenchmark(
+        const TransformHierarchyBenchmarkConfig& config) {
+
+        std::unique_ptr<Core::ThreadPool> pool;
+        if (config.threadCount > 0) {
+            pool = std::make_unique<Core::ThreadPool>(config.threadCount);
+        }
+
+        std::vector<TransformHierarchyBenchmarkResult> results;
+        const size_t dirtyCount = static_cast<size_t>(config.nodeCount * config.dirtyFraction);
+
+        auto runWorkloads = [&](Core::ThreadPool* path) {
+            results.push_back(Measure(config, "all moved", path,
+                [](entt::registry& registry, const std::vector<entt::entity>& nodes,
+                    const std::vector<entt::entity>&, int frame) {
+                    for (entt::entity entity : nodes) {
+                        Move(registry, entity, frame);
+                    }
+                }));
+
+            results.push_back(Measure(config, "roots moved", path,
+                [](entt::registry& registry, const std::vector<entt::entity>&,
+                    const std::vector<entt::entity>& roots, int frame) {
+                    for (entt::entity entity : roots) {
+                        Move(registry, entity, frame);
+                    }
+                }));
+
+            results.push_back(Measure(config, "partial", path,
+                [dirtyCount](entt::registry& registry, const std::vector<entt::entity>& nodes,
+                    const std::vector<entt::entity>&, int frame) {
+                    std::mt19937 rng(static_cast<uint32_t>(frame));
+                    for (size_t i = 0; i < dirtyCount; ++i) {
+                        Move(registry, nodes[rng() % nodes.size()], frame);
+                    }
+                }));
+
+            results.push_back(Measure(config, "idle", path,
+                [](entt::registry&, const std::vector<entt::entity>&, const std::vector<entt::entity>&, int) {}));
+        };
+
+        runWorkloads(nullptr);
+        if (pool) {
+            runWorkloads(pool.get());
+        }
+
+        return results;
+    }
+
+    void LogTransformHierarchyBenchmarkResults(const std::vector<TransformHierarchyBenchmarkResult>& results) {
+        YAMEN_CORE_INFO("Transform hierarchy benchmark");
+        YAMEN_CORE_INFO("  {:>12} | {:>6} | {:>10} | {:>10}",
+            "workload", "path", "ms/frame", "matrices");
+
+        for (const auto& r : results) {
+            YAMEN_CORE_INFO("  {:>12} | {:>6} | {:>10.3f} | {:>10}",
+                r.workload, r.path, r.millisecondsPerFrame, r.matricesPerFrame);
+        }
+    }
+
+} // namespace Yamen::Tools
@@ -0,0 +1,125 @@
+#include "Tools/Benchmarks/XPBDBroadPhaseBenchmark.h"
+#include <Core/Logging/Logger.h>
+#include <ECS/Components/CoreComponents.h>
+#include <ECS/Components/PhysicsComponents.h>
+#include <ECS/Components/XPBDComponents.h>
+#include <ECS/Scene.h>
+#include <ECS/Systems/XPBDSolver.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+
+namespace Yamen::Tools {
+
+    namespace {
+
+        using BroadPhaseMode = ECS::XPBDSolver::BroadPhaseMode;
+
+        // Spheres scattered through a cube sized for the requested fill fraction,
+        // optionally resting over a static ground box much wider than any of them
+        void BuildParticles(ECS::Scene& scene, size_t count, const XPBDBroadPhaseBenchmarkConfig& config) {
+            auto& registry = scene.Registry();
+
+            const float radius = config.particleRadius;
+            const float sphereVolume = 4.18879f * radius * radius * radius;
+            const float boxVolume = sphereVolume * static_cast<float>(count) / std::max(config.fillFraction, 1e-3f);
+            const float halfSize = 0.5f * std::cbrt(boxVolume);
+
+            std::mt19937 rng(1234);
+            std::uniform_real_distribution<float> coordinate(-halfSize, halfSize);
+
+            for (size_t i = 0; i < count; ++i) {
+                entt::entity entity = registry.create();
+                const Core::vec3 position(coordinate(rng), coordinate(rng) + halfSize, coordinate(rng));
+
+                registry.emplace<ECS::TransformComponent>(entity).Translation = position;
+                registry.emplace<ECS::ColliderComponent>(entity, ECS::SphereCollider{ radius });
+
+                auto& particle = registry.emplace<ECS::XPBDParticleComponent>(entity);
+                particle.Position = position;
+                particle.PreviousPosition = position;
+            }
+
+            if (config.groundCollider) {
+                entt::entity ground = registry.create();
+                const Core::vec3 position(0.0f, -1.0f, 0.0f);
+                const float groundHalfSize = std::max(2.0f * halfSize, config.groundHalfSize);
+
+                registry.emplace<ECS::TransformComponent>(ground).Translation = position;
+                registry.emplace<ECS::ColliderComponent>(ground,
+                    ECS::BoxCollider{ Core::vec3(groundHalfSize, 1.0f, groundHalfSize) });
+
+                auto& particle = registry.emplace<ECS::XPBDParticleComponent>(ground);
+                particle.Position = position;
+                particle.PreviousPosition = position;
+                particle.InverseMass = 0.0f;
+            }
+        }
+
+        XPBDBroadPhaseBenchmarkResult Measure(const XPBDBroadPhaseBenchmarkConfig& config,
+            size_t count, BroadPhaseMode mode) {
+
+            XPBDBroadPhaseBenchmarkResult result;
+            result.particleCount = count;
+            result.broadPhase = mode == BroadPhaseMode::AllPairs ? "all pairs" : "spatial hash";
+
+            const int frames = std::max(config.frames, 1);
+            for (int rep = 0; rep < std::max(config.repetitions, 1); ++rep) {
+                ECS::Scene scene("XPBDBroadPhaseBenchmark");
+                BuildParticles(scene, count, config);
+
+                ECS::XPBDSolver solver;
+                solver.BroadPhase = mode;
+                solver.EnableSleeping = false;
+
+                auto start = std::chrono::steady_clock::now();
+                for (int frame = 0; frame < frames; ++frame) {
+                    solver.OnUpdate(&scene, 1.0f / 60.0f);
+                }
+                double ms = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - start).count() / frames;
+
+                if (rep == 0 || ms < result.millisecondsPerFrame) {
+                    const auto stats = solver.GetStats();
+                    result.millisecondsPerFrame = ms;
+                    result.collisionMilliseconds = stats.CollisionTime;
+                    result.candidatePairs = static_cast<size_t>(stats.BroadPhasePairs);
+                    result.contacts = static_cast<size_t>(stats.ContactConstraints);
+                }
+            }
+            return result;
+        }
+
+    } // namespace
+
+    std::vector<XPBDBroadPhaseBenchmarkResult> RunXPBDBroadPhaseBenchmark(
+        const XPBDBroadPhaseBenchmarkConfig& config) {
+
+        std::vector<XPBDBroadPhaseBenchmarkResult> results;
+        for (size_t count : config.particleCounts) {
+            const bool reference = count <= config.allPairsMaxCount;
+            if (reference) {
+                results.push_back(Measure(config, count, BroadPhaseMode::AllPairs));
+            }
+            results.push_back(Measure(config, count, BroadPhaseMode::SpatialHash));
+            if (reference) {
+                results.back().matchesAllPairs = results.back().contacts == results[results.size() - 2].contacts;
+            }
+        }
+        return results;
+    }
+
+    void LogXPBDBroadPhaseBenchmarkResults(const std::vector<XPBDBroadPhaseBenchmarkResult>& results) {
+        YAMEN_CORE_INFO("XPBD broad phase benchmark");
+        YAMEN_CORE_INFO("  {:>9} | {:>12} | {:>10} | {:>12} | {:>10} | {:>8} | {:>7}",
+            "particles", "broad phase", "ms/frame", "collision ms", "pairs", "contacts", "check");
+
+        for (const auto& r : results) {
+            YAMEN_CORE_INFO("  {:>9} | {:>12} | {:>10.3f} | {:>12.3f} | {:>10} | {:>8} | {:>7}",
+                r.particleCount, r.broadPhase, r.millisecondsPerFrame, r.collisionMilliseconds,
+                r.candidatePairs, r.contacts, r.matchesAllPairs ? "match" : "DIFFERS");
+        }
+    }
+
+} // namespace Yamen::Tools
@@ -0,0 +1,211 @@
+#include "Tools/Benchmarks/XPBDParticleStoreBenchmark.h"
+#include <Core/Logging/Logger.h>
+#include <ECS/Components/CoreComponents.h>
+#include <ECS/Components/PhysicsComponents.h>
+#include <ECS/Components/XPBDComponents.h>
+#include <ECS/Physics/XPBDConstraintStore.h>
+#include <ECS/Scene.h>
+#include <Core/Threading/ThreadPool.h>
+#include <ECS/Systems/XPBDSolver.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <random>
+
+namespace Yamen::Tools {
+
+    namespace {
+
+        constexpr float Spacing = 0.1f;
+        constexpr float SphereRadius = 0.05f;
+
+        struct SolveMode {
+            const char* name;
+            bool parallel;
+            int maxContactColors;
+        };
+
+        constexpr SolveMode SolveModes[] = {
+            { "serial", false, 8 },
+            { "parallel", true, 8 },
+            { "jacobi", true, 0 }
+        };
+
+        entt::entity CreateParticle(entt::registry& registry, const Core::vec3& position, float inverseMass) {
+            entt::entity entity = registry.create();
+            registry.emplace<ECS::TransformComponent>(entity).Translation = position;
+            registry.emplace<ECS::ColliderComponent>(entity, ECS::SphereCollider{ SphereRadius });
+
+            auto& particle = registry.emplace<ECS::XPBDParticleComponent>(entity);
+            particle.Position = position;
+            particle.PreviousPosition = position;
+            particle.InverseMass = inverseMass;
+            return entity;
+        }
+
+        // Cloth pinned along one edge, with structural and bending constraints,
+        // and spheres dropped onto it
+        void BuildScene(ECS::Scene& scene, size_t size, const XPBDParticleStoreBenchmarkConfig& config) {
+            auto& registry = scene.Registry();
+
+            std::vector<entt::entity> grid(size * size);
+            for (size_t x = 0; x < size; ++x) {
+                for (size_t z = 0; z < size; ++z) {
+                    const Core::vec3 position(x * Spacing, 2.0f, z * Spacing);
+                    grid[x * size + z] = CreateParticle(registry, position, z == 0 ? 0.0f : 1.0f);
+                }
+            }
+
+            auto& constraints = ECS::XPBDConstraintStore::Get(registry);
+            auto addConstraint = [&](const auto& constraint) {
+                constraints.Emplace(registry.create(), constraint);
+            };
+
+            for (size_t x = 0; x < size; ++x) {
+                for (size_t z = 0; z < size; ++z) {
+                    const entt::entity p = grid[x * size + z];
+                    if (x + 1 < size) {
+                        addConstraint(ECS::DistanceConstraint(p, grid[(x + 1) * size + z], Spacing));
+                    }
+                    if (z + 1 < size) {
+                        addConstraint(ECS::DistanceConstraint(p, grid[x * size + z + 1], Spacing, 1e-5f));
+                    }
+                    if (x + 1 < size && z + 1 < size) {
+                        addConstraint(ECS::BendingConstraint(p, grid[(x + 1) * size + z + 1],
+                            grid[(x + 1) * size + z], grid[x * size + z + 1], 0.0f));
+                    }
+                }
+            }
+
+            const float extent = size * Spacing;
+            std::mt19937 rng(1234);
+            std::uniform_real_distribution<float> coordinate(0.0f, extent);
+            for (size_t i = 0; i < config.sphereCount; ++i) {
+                CreateParticle(registry, Core::vec3(coordinate(rng), 2.5f + coordinate(rng), coordinate(rng)), 1.0f);
+            }
+        }
+
+        struct Snapshot {
+            std::vector<ECS::XPBDParticleComponent> particles;
+            std::vector<float> lambdas;
+        };
+
+        Snapshot TakeSnapshot(ECS::Scene& scene) {
+            auto& registry = scene.Registry();
+            Snapshot snapshot;
+
+            auto& particles = registry.storage<ECS::XPBDParticleComponent>();
+            for (entt::entity entity : particles) {
+                snapshot.particles.push_back(particles.get(entity));
+            }
+
+            ECS::XPBDConstraintStore::Get(registry).ForEachArray([&](const auto& array) {
+                for (const auto& constraint : array.Constraints) {
+                    snapshot.lambdas.push_back(constraint.Lambda);
+                }
+            });
+            return snapshot;
+        }
+
+        bool BitwiseEqual(const Snapshot& a, const Snapshot& b) {
+            if (a.particles.size() != b.particles.size() || a.lambdas.size() != b.lambdas.size()) {
+                return false;
+            }
+
+            auto same = [](const auto& x, const auto& y) { return std::memcmp(&x, &y, sizeof(x)) == 0; };
+            for (size_t i = 0; i < a.particles.size(); ++i) {
+                const auto& p = a.particles[i];
+                const auto& q = b.particles[i];
+                if (!same(p.Position, q.Position) || !same(p.PreviousPosition, q.PreviousPosition) ||
+                    !same(p.Velocity, q.Velocity) || !same(p.ExternalForce, q.ExternalForce) ||
+                    p.IsSleeping != q.IsSleeping || !same(p.SleepTimer, q.SleepTimer)) {
+                    return false;
+                }
+            }
+            for (size_t i = 0; i < a.lambdas.size(); ++i) {
+                if (!same(a.lambdas[i], b.lambdas[i])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        XPBDParticleStoreBenchmarkResult Measure(const XPBDParticleStoreBenchmarkConfig& config,
+            size_t size, bool useStore, const SolveMode& mode, Core::ThreadPool* pool, Snapshot& snapshot) {
+
+            XPBDParticleStoreBenchmarkResult result;
+            result.path = useStore ? "particle store" : "components";
+            result.solve = mode.name;
+
+            const int frames = std::max(config.frames, 1);
+            for (int rep = 0; rep < std::max(config.repetitions, 1); ++rep) {
+                ECS::Scene scene("XPBDParticleStoreBenchmark");
+                scene.SetThreadPool(pool);
+                BuildScene(scene, size, config);
+
+                ECS::XPBDSolver solver;
+                solver.UseParticleStore = useStore;
+                solver.ParallelSolve = mode.parallel;
+                solver.MaxContactColors = mode.maxContactColors;
+
+                auto start = std::chrono::steady_clock::now();
+                for (int frame = 0; frame < frames; ++frame) {
+                    solver.OnUpdate(&scene, 1.0f / 60.0f);
+                }
+                double ms = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - start).count() / frames;
+
+                if (rep == 0 || ms < result.millisecondsPerFrame) {
+                    result.millisecondsPerFrame = ms;
+                }
+                if (rep == 0) {
+                    auto& registry = scene.Registry();
+                    result.particleCount = registry.storage<ECS::XPBDParticleComponent>().size();
+                    result.constraintCount = ECS::XPBDConstraintStore::Get(registry).Size();
+                    snapshot = TakeSnapshot(scene);
+                }
+            }
+            return result;
+        }
+
+    } // namespace
+
+    std::vector<XPBDParticleStoreBenchmarkResult> RunXPBDParticleStoreBenchmark(
+        const XPBDParticleStoreBenchmarkConfig& config) {
+
+        std::unique_ptr<Core::ThreadPool> pool;
+        if (config.parallelSolve && config.threadCount > 0) {
+            pool = std::make_unique<Core::ThreadPool>(config.threadCount);
+        }
+
+        std::vector<XPBDParticleStoreBenchmarkResult> results;
+        for (const SolveMode& mode : SolveModes) {
+            if (mode.parallel && !config.parallelSolve) {
+                continue;
+            }
+
+            for (size_t size : config.clothSizes) {
+                Snapshot reference;
+                Snapshot packed;
+                results.push_back(Measure(config, size, false, mode, pool.get(), reference));
+                results.push_back(Measure(config, size, true, mode, pool.get(), packed));
+                results.back().matchesComponents = BitwiseEqual(reference, packed);
+            }
+        }
+        return results;
+    }
+
+    void LogXPBDParticleStoreBenchmarkResults(const std::vector<XPBDParticleStoreBenchmarkResult>& results) {
+        YAMEN_CORE_INFO("XPBD particle store benchmark");
+        YAMEN_CORE_INFO("  {:>9} | {:>11} | {:>14} | {:>8} | {:>10} | {:>7}",
+            "particles", "constraints", "path", "solve", "ms/frame", "bitwise");
+
+        for (const auto& r : results) {
+            YAMEN_CORE_INFO("  {:>9} | {:>11} | {:>14} | {:>8} | {:>10.3f} | {:>7}",
+                r.particleCount, r.constraintCount, r.path, r.solve, r.millisecondsPerFrame,
+                r.matchesComponents ? "match" : "DIFFERS");
+        }
+    }
+
+} // namespace Yamen::Tools
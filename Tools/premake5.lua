@@ -16,12 +16,17 @@ project "Tools"
         "Include",
         "../EngineCore/Include",
         "../Platform/Include",
+        "../ECS/Include",
+        "%{IncludeDirs.entt}",
+        "%{IncludeDirs.spdlog}",
+        "%{IncludeDirs.fmt}",
         "%{IncludeDirs.imgui}"
     }
     
     links {
         "EngineCore",
-        "Platform"
+        "Platform",
+        "ECS"
     }
     
     filter "system:windows"
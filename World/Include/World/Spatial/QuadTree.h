@@ -4,6 +4,7 @@
 #include "World/Culling/Frustum.h"
 #include <entt/entt.hpp>
 #include <memory>
+#include <memory_resource>
 #include <vector>
 
 
@@ -16,7 +17,13 @@ struct QuadTreeData {
 
 class QuadTree {
 public:
-  QuadTree(const Core::AABB &bounds, int capacity = 4, int maxDepth = 5);
+  /**
+   * @param resource Memory for node contents; children share it (e.g. a
+   *        PoolMemoryResource or a per-frame resource for rebuilt trees)
+   */
+  QuadTree(const Core::AABB &bounds, int capacity = 4, int maxDepth = 5,
+           std::pmr::memory_resource *resource =
+               std::pmr::get_default_resource());
   ~QuadTree();
 
   /**
@@ -34,12 +41,14 @@ public:
   /**
    * @brief Query objects within a range
    */
-  void Query(const Core::AABB &range, std::vector<entt::entity> &found) const;
+  void Query(const Core::AABB &range,
+             std::pmr::vector<entt::entity> &found) const;
 
   /**
    * @brief Query objects within a frustum
    */
-  void Query(const Frustum &frustum, std::vector<entt::entity> &found) const;
+  void Query(const Frustum &frustum,
+             std::pmr::vector<entt::entity> &found) const;
 
   /**
    * @brief Clear the tree
@@ -57,7 +66,7 @@ private:
   int m_MaxDepth;
   int m_Depth;
 
-  std::vector<QuadTreeData> m_Objects;
+  std::pmr::vector<QuadTreeData> m_Objects;
   std::unique_ptr<QuadTree> m_Children[4]; // NW, NE, SW, SE
   bool m_Divided = false;
 };
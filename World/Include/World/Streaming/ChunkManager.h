@@ -2,11 +2,13 @@
 
 #include "Core/Math/Math.h"
 #include "Core/Threading/ThreadPool.h"
+#include "Core/Threading/Task.h"
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
 #include <future>
 #include <functional>
+#include <memory_resource>
 #include <mutex>
 
 namespace Yamen::World {
@@ -43,6 +45,7 @@ namespace Yamen::World {
      *
      * Features:
      * - Async chunk loading using thread pool
+     * - Loads for chunks that leave the load radius are cancelled
      * - Distance-based chunk culling
      * - Callbacks for load/unload operations
      * - Thread-safe operations
@@ -109,9 +112,25 @@ namespace Yamen::World {
          * @brief Callback for loading a chunk
          * @param coord Chunk coordinate to load
          * @return true if load successful, false otherwise
+         *
+         * Runs on a pool worker. Long loads should poll ThreadPool::IsCurrentTaskCancelled()
+         * and return false early once the chunk has left the load radius.
          */
         using LoadCallback = std::function<bool(const ChunkCoord&)>;
 
+        /**
+         * @brief Coroutine callback for loading a chunk
+         * @param coord Chunk coordinate to load
+         * @param cancellation Cancelled when the chunk leaves the load radius
+         * @return Task resolving to true if load successful
+         *
+         * The task is started on the thread calling Update() and may hop between the
+         * pool and the main thread (e.g. ReadFileAsync, then NextFrame for the GPU upload)
+         * without blocking a worker. Used instead of the LoadCallback when set. Check the
+         * token between steps and before publishing anything.
+         */
+        using AsyncLoadCallback = std::function<Core::Task<bool>(const ChunkCoord&, Core::CancellationToken)>;
+
         /**
          * @brief Callback for unloading a chunk
          * @param coord Chunk coordinate to unload
@@ -123,11 +142,31 @@ namespace Yamen::World {
          */
         void SetLoadCallback(LoadCallback cb) { m_LoadCallback = std::move(cb); }
 
+        /**
+         * @brief Set coroutine chunk load callback (takes precedence over SetLoadCallback)
+         */
+        void SetAsyncLoadCallback(AsyncLoadCallback cb) { m_AsyncLoadCallback = std::move(cb); }
+
         /**
          * @brief Set chunk unload callback
          */
         void SetUnloadCallback(UnloadCallback cb) { m_UnloadCallback = std::move(cb); }
 
+        /**
+         * @brief Set the memory load callbacks allocate chunk payloads from
+         *
+         * Pass a Core::TLSFAllocator to keep streaming within a fixed budget. It must
+         * outlive every loaded chunk. Defaults to the global heap.
+         */
+        void SetPayloadResource(std::pmr::memory_resource* resource) noexcept {
+            m_PayloadResource = resource ? resource : std::pmr::get_default_resource();
+        }
+
+        /**
+         * @brief Get the memory load callbacks should allocate chunk payloads from
+         */
+        std::pmr::memory_resource* GetPayloadResource() const noexcept { return m_PayloadResource; }
+
         /**
          * @brief Force unload all chunks
          */
@@ -144,17 +183,49 @@ namespace Yamen::World {
          */
         bool IsChunkInRange(const ChunkCoord& coord, const ChunkCoord& center) const;
 
+        /**
+         * @brief Start loading a chunk through the async or plain load callback
+         */
+        void StartLoad(const ChunkCoord& coord);
+
+        /**
+         * @brief Cancel pending loads for chunks outside @p chunksToKeep
+         */
+        void CancelStaleLoads(const std::unordered_set<ChunkCoord, ChunkCoordHash>& chunksToKeep);
+
+        /**
+         * @brief Move finished loads from pending to loaded (or release/restart them)
+         */
+        void PollCompletedLoads();
+
+        /**
+         * @brief Record the outcome of a finished load
+         */
+        void FinishLoad(const ChunkCoord& coord, bool success);
+
+        /**
+         * @brief One in-flight load, through either callback type
+         */
+        struct PendingLoad {
+            std::future<bool> future;           // LoadCallback path
+            Core::Task<bool> task;              // AsyncLoadCallback path
+            Core::CancellationSource cancellation;
+            bool cancelled = false;             // Left the load radius; not counted as pending
+        };
+
     private:
         float m_ChunkSize;
         int m_LoadRadius;
         Yamen::Core::ThreadPool& m_ThreadPool;
 
         std::unordered_set<ChunkCoord, ChunkCoordHash> m_LoadedChunks;
-        std::unordered_set<ChunkCoord, ChunkCoordHash> m_PendingChunks;
-        std::unordered_map<ChunkCoord, std::future<bool>, ChunkCoordHash> m_LoadFutures;
+        std::unordered_set<ChunkCoord, ChunkCoordHash> m_PendingChunks;   // In range, load in flight
+        std::unordered_map<ChunkCoord, PendingLoad, ChunkCoordHash> m_PendingLoads;
 
         LoadCallback m_LoadCallback;
+        AsyncLoadCallback m_AsyncLoadCallback;
         UnloadCallback m_UnloadCallback;
+        std::pmr::memory_resource* m_PayloadResource = std::pmr::get_default_resource();
 
         ChunkCoord m_LastCenterChunk = { -9999, -9999 };
 
@@ -3,15 +3,18 @@
 
 namespace Yamen::World {
 
-QuadTree::QuadTree(const Core::AABB &bounds, int capacity, int maxDepth)
-    : m_Bounds(bounds), m_Capacity(capacity), m_MaxDepth(maxDepth), m_Depth(0) {
+QuadTree::QuadTree(const Core::AABB &bounds, int capacity, int maxDepth,
+                   std::pmr::memory_resource *resource)
+    : m_Bounds(bounds), m_Capacity(capacity), m_MaxDepth(maxDepth), m_Depth(0),
+      m_Objects(resource) {
   m_Objects.reserve(capacity);
 }
 
 // In CreateChild:
 static QuadTree *CreateChild(const Core::AABB &bounds, int capacity,
-                             int maxDepth, int depth) {
-  auto *qt = new QuadTree(bounds, capacity, maxDepth);
+                             int maxDepth, int depth,
+                             std::pmr::memory_resource *resource) {
+  auto *qt = new QuadTree(bounds, capacity, maxDepth, resource);
   qt->SetDepth(depth);
   return qt;
 }
@@ -76,7 +79,7 @@ bool QuadTree::Remove(entt::entity entity, const Core::AABB &bounds) {
 }
 
 void QuadTree::Query(const Core::AABB &range,
-                     std::vector<entt::entity> &found) const {
+                     std::pmr::vector<entt::entity> &found) const {
   if (!m_Bounds.Intersects(range)) {
     return;
   }
@@ -95,7 +98,7 @@ void QuadTree::Query(const Core::AABB &range,
 }
 
 void QuadTree::Query(const Frustum &frustum,
-                     std::vector<entt::entity> &found) const {
+                     std::pmr::vector<entt::entity> &found) const {
   if (!frustum.ContainsBox(m_Bounds.Min, m_Bounds.Max)) {
     return;
   }
@@ -149,13 +152,17 @@ void QuadTree::Subdivide() {
                       Core::vec3(max.x, max.y, center.z));
 
   m_Children[0].reset(
-      CreateChild(nwBounds, m_Capacity, m_MaxDepth, m_Depth + 1));
+      CreateChild(nwBounds, m_Capacity, m_MaxDepth, m_Depth + 1,
+                  m_Objects.get_allocator().resource()));
   m_Children[1].reset(
-      CreateChild(neBounds, m_Capacity, m_MaxDepth, m_Depth + 1));
+      CreateChild(neBounds, m_Capacity, m_MaxDepth, m_Depth + 1,
+                  m_Objects.get_allocator().resource()));
   m_Children[2].reset(
-      CreateChild(swBounds, m_Capacity, m_MaxDepth, m_Depth + 1));
+      CreateChild(swBounds, m_Capacity, m_MaxDepth, m_Depth + 1,
+                  m_Objects.get_allocator().resource()));
   m_Children[3].reset(
-      CreateChild(seBounds, m_Capacity, m_MaxDepth, m_Depth + 1));
+      CreateChild(seBounds, m_Capacity, m_MaxDepth, m_Depth + 1,
+                  m_Objects.get_allocator().resource()));
 
   m_Divided = true;
 }
@@ -1,11 +1,39 @@
 #include "World/Streaming/ChunkManager.h"
 #include <Core/Logging/Logger.h>
+#include <Core/Memory/MemoryTracker.h>
 #include "Core/Threading/ThreadPool.h"
 #include <chrono>
 #include <algorithm>
 
 namespace Yamen::World {
 
+    namespace {
+
+        // Awaits a coroutine load the manager has let go of and releases the chunk if
+        // the load completed anyway. Runs on whichever thread finishes the load.
+        Core::Task<void> ReleaseDetachedLoad(Core::Task<bool> load, ChunkCoord coord,
+            ChunkManager::UnloadCallback unload) {
+
+            bool success = false;
+            try {
+                success = co_await std::move(load);
+            }
+            catch (const std::exception& e) {
+                YAMEN_CORE_ERROR("Chunk load threw exception: {}", e.what());
+            }
+
+            if (success && unload) {
+                try {
+                    unload(coord);
+                }
+                catch (const std::exception& e) {
+                    YAMEN_CORE_ERROR("Exception during chunk unload: {}", e.what());
+                }
+            }
+        }
+
+    } // namespace
+
     ChunkManager::ChunkManager(Yamen::Core::ThreadPool& threadPool, float chunkSize, int loadRadius)
         : m_ChunkSize(chunkSize)
         , m_LoadRadius(loadRadius)
@@ -40,39 +68,13 @@ namespace Yamen::World {
     }
 
     void ChunkManager::Update(const Core::vec3& viewerPosition) {
+        Core::ScopedMemoryTag memoryTag(Core::MemoryTag::World);
         ChunkCoord centerChunk = GetChunkCoord(viewerPosition);
 
         // Early exit if viewer hasn't moved to a new chunk
         if (centerChunk == m_LastCenterChunk) {
-            // Still check for completed futures even if center hasn't changed
-            for (auto it = m_LoadFutures.begin(); it != m_LoadFutures.end(); ) {
-                auto& fut = it->second;
-                if (fut.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
-                    bool success = false;
-                    try {
-                        success = fut.get();
-                    }
-                    catch (const std::exception& e) {
-                        YAMEN_CORE_ERROR("Chunk load future threw exception: {}", e.what());
-                    }
-
-                    ChunkCoord coord = it->first;
-                    m_PendingChunks.erase(coord);
-
-                    if (success) {
-                        m_LoadedChunks.insert(coord);
-                        YAMEN_CORE_TRACE("Chunk loaded: ({}, {})", coord.x, coord.z);
-                    }
-                    else {
-                        YAMEN_CORE_WARN("Failed to load chunk: ({}, {})", coord.x, coord.z);
-                    }
-
-                    it = m_LoadFutures.erase(it);
-                }
-                else {
-                    ++it;
-                }
-            }
+            // Still check for completed loads even if center hasn't changed
+            PollCompletedLoads();
             return;
         }
 
@@ -87,60 +89,31 @@ namespace Yamen::World {
                 ChunkCoord coord{ centerChunk.x + x, centerChunk.z + z };
                 chunksToKeep.insert(coord);
 
-                // Start async load if not already loaded/pending/future
-                bool alreadyLoaded = m_LoadedChunks.find(coord) != m_LoadedChunks.end();
-                bool alreadyPending = m_PendingChunks.find(coord) != m_PendingChunks.end();
-                bool hasFuture = m_LoadFutures.find(coord) != m_LoadFutures.end();
-
-                if (!alreadyLoaded && !alreadyPending && !hasFuture) {
-                    if (m_LoadCallback) {
-                        try {
-                            auto future = m_ThreadPool.Enqueue([this, coord]() -> bool {
-                                return m_LoadCallback(coord);
-                                });
-                            m_LoadFutures.emplace(coord, std::move(future));
-                            m_PendingChunks.insert(coord);
-
-                            YAMEN_CORE_TRACE("Started loading chunk: ({}, {})", coord.x, coord.z);
-                        }
-                        catch (const std::exception& e) {
-                            YAMEN_CORE_ERROR("Failed to enqueue chunk load: {}", e.what());
-                        }
-                    }
-                }
-            }
-        }
-
-        // Poll futures for completed loads
-        for (auto it = m_LoadFutures.begin(); it != m_LoadFutures.end(); ) {
-            auto& fut = it->second;
-            if (fut.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
-                bool success = false;
-                try {
-                    success = fut.get();
-                }
-                catch (const std::exception& e) {
-                    YAMEN_CORE_ERROR("Chunk load future threw exception: {}", e.what());
+                if (m_LoadedChunks.find(coord) != m_LoadedChunks.end()) {
+                    continue;
                 }
 
-                ChunkCoord coord = it->first;
-                m_PendingChunks.erase(coord);
-
-                if (success) {
-                    m_LoadedChunks.insert(coord);
-                    YAMEN_CORE_TRACE("Chunk loaded: ({}, {})", coord.x, coord.z);
-                }
-                else {
-                    YAMEN_CORE_WARN("Failed to load chunk: ({}, {})", coord.x, coord.z);
+                // Back in range before a cancelled load finished: track it again; if it
+                // was dropped, PollCompletedLoads restarts it
+                auto pending = m_PendingLoads.find(coord);
+                if (pending != m_PendingLoads.end()) {
+                    if (pending->second.cancelled) {
+                        pending->second.cancelled = false;
+                        m_PendingChunks.insert(coord);
+                    }
+                    continue;
                 }
 
-                it = m_LoadFutures.erase(it);
-            }
-            else {
-                ++it;
+                StartLoad(coord);
             }
         }
 
+        // Withdraw loads for chunks the viewer has moved away from
+        CancelStaleLoads(chunksToKeep);
+
+        // Poll for completed loads
+        PollCompletedLoads();
+
         // Unload chunks that are no longer needed
         for (auto it = m_LoadedChunks.begin(); it != m_LoadedChunks.end(); ) {
             if (chunksToKeep.find(*it) == chunksToKeep.end()) {
@@ -164,19 +137,167 @@ namespace Yamen::World {
         }
     }
 
+    void ChunkManager::StartLoad(const ChunkCoord& coord) {
+        if (m_AsyncLoadCallback) {
+            try {
+                PendingLoad load;
+                load.task = m_AsyncLoadCallback(coord, load.cancellation.GetToken());
+                load.task.Start();
+                m_PendingLoads.emplace(coord, std::move(load));
+                m_PendingChunks.insert(coord);
+
+                YAMEN_CORE_TRACE("Started loading chunk: ({}, {})", coord.x, coord.z);
+            }
+            catch (const std::exception& e) {
+                YAMEN_CORE_ERROR("Failed to start chunk load task: {}", e.what());
+            }
+        }
+        else if (m_LoadCallback) {
+            try {
+                PendingLoad load;
+
+                Core::TaskOptions options;
+                options.priority = Core::TaskPriority::Low;
+                options.cancellation = load.cancellation.GetToken();
+
+                load.future = m_ThreadPool.Enqueue(options, [this, coord]() -> bool {
+                    return m_LoadCallback(coord);
+                    });
+                m_PendingLoads.emplace(coord, std::move(load));
+                m_PendingChunks.insert(coord);
+
+                YAMEN_CORE_TRACE("Started loading chunk: ({}, {})", coord.x, coord.z);
+            }
+            catch (const std::exception& e) {
+                YAMEN_CORE_ERROR("Failed to enqueue chunk load: {}", e.what());
+            }
+        }
+    }
+
+    void ChunkManager::CancelStaleLoads(const std::unordered_set<ChunkCoord, ChunkCoordHash>& chunksToKeep) {
+        for (auto& [coord, load] : m_PendingLoads) {
+            if (load.cancelled || chunksToKeep.find(coord) != chunksToKeep.end()) {
+                continue;
+            }
+
+            // Queued loads are dropped by the pool; running ones see the token and exit early
+            load.cancellation.Cancel();
+            load.cancelled = true;
+            m_PendingChunks.erase(coord);
+
+            YAMEN_CORE_TRACE("Cancelled chunk load: ({}, {})", coord.x, coord.z);
+        }
+    }
+
+    void ChunkManager::PollCompletedLoads() {
+        struct FinishedLoad {
+            ChunkCoord coord;
+            bool success;
+            bool wasCancelled;
+        };
+        std::vector<FinishedLoad> finished;
+
+        for (auto it = m_PendingLoads.begin(); it != m_PendingLoads.end(); ) {
+            PendingLoad& load = it->second;
+
+            const bool ready = load.task.IsValid()
+                ? load.task.IsReady()
+                : load.future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+
+            if (!ready) {
+                ++it;
+                continue;
+            }
+
+            bool success = false;
+            try {
+                success = load.task.IsValid() ? load.task.GetResult() : load.future.get();
+            }
+            catch (const Core::TaskCancelledError&) {
+                // Dropped from the queue before it started
+            }
+            catch (const std::exception& e) {
+                YAMEN_CORE_ERROR("Chunk load threw exception: {}", e.what());
+            }
+
+            finished.push_back({ it->first, success, load.cancellation.IsCancellationRequested() });
+            it = m_PendingLoads.erase(it);
+        }
+
+        // Handled after the scan since restarting a load inserts into m_PendingLoads
+        for (const FinishedLoad& load : finished) {
+            const bool inRange = IsChunkInRange(load.coord, m_LastCenterChunk);
+
+            if (inRange && !load.success && load.wasCancelled) {
+                // Cancelled, then came back into range before the load wound down
+                m_PendingChunks.erase(load.coord);
+                StartLoad(load.coord);
+            }
+            else if (inRange) {
+                FinishLoad(load.coord, load.success);
+            }
+            else if (load.success && m_UnloadCallback) {
+                // Finished despite the cancellation; release what it loaded
+                try {
+                    m_UnloadCallback(load.coord);
+                }
+                catch (const std::exception& e) {
+                    YAMEN_CORE_ERROR("Chunk unload callback threw exception: {}", e.what());
+                }
+            }
+        }
+    }
+
+    void ChunkManager::FinishLoad(const ChunkCoord& coord, bool success) {
+        m_PendingChunks.erase(coord);
+
+        if (success) {
+            m_LoadedChunks.insert(coord);
+            YAMEN_CORE_TRACE("Chunk loaded: ({}, {})", coord.x, coord.z);
+        }
+        else {
+            YAMEN_CORE_WARN("Failed to load chunk: ({}, {})", coord.x, coord.z);
+        }
+    }
+
     void ChunkManager::UnloadAll() {
         YAMEN_CORE_INFO("Unloading all chunks...");
 
-        // Wait for all pending loads to complete
-        for (auto& [coord, future] : m_LoadFutures) {
+        // Withdraw every outstanding load: queued ones are dropped, running ones exit early
+        for (auto& [coord, load] : m_PendingLoads) {
+            load.cancellation.Cancel();
+        }
+
+        for (auto& [coord, load] : m_PendingLoads) {
+            // Load coroutines may be waiting on the main thread, so they cannot be waited
+            // for here; a detached coroutine takes over releasing their chunk
+            if (load.task.IsValid() && !load.task.IsReady()) {
+                Core::Task<void> release = ReleaseDetachedLoad(std::move(load.task), coord, m_UnloadCallback);
+                release.Start();
+                continue;
+            }
+
+            bool success = false;
             try {
-                future.wait();
+                success = load.task.IsValid() ? load.task.GetResult() : load.future.get();
+            }
+            catch (const Core::TaskCancelledError&) {
             }
             catch (const std::exception& e) {
-                YAMEN_CORE_ERROR("Exception while waiting for chunk future: {}", e.what());
+                YAMEN_CORE_ERROR("Exception while waiting for chunk load: {}", e.what());
+            }
+
+            // A load that completed anyway still has to be released
+            if (success && m_UnloadCallback) {
+                try {
+                    m_UnloadCallback(coord);
+                }
+                catch (const std::exception& e) {
+                    YAMEN_CORE_ERROR("Exception during chunk unload: {}", e.what());
+                }
             }
         }
-        m_LoadFutures.clear();
+        m_PendingLoads.clear();
         m_PendingChunks.clear();
 
         // Unload all loaded chunks
@@ -2,6 +2,20 @@
 -- Yamen Engine & YServer  - Root Build Configuration
 -- ============================================================
 
+newoption {
+    trigger     = "track-memory",
+    description = "Charge every heap allocation to a memory tag (replaces global operator new/delete)"
+}
+
+newoption {
+    trigger     = "simd",
+    value       = "ISA",
+    description = "Instruction set for Core::simd kernels (default SSE on x64)",
+    allowed     = {
+        { "avx2", "AVX2 (8-wide registers)" }
+    }
+}
+
 workspace "YamenEngine"
     architecture "x64"
     startproject "Client"
@@ -19,6 +33,12 @@ workspace "YamenEngine"
 
     flags { "MultiProcessorCompile" }
 
+    filter "options:track-memory"
+        defines { "YAMEN_TRACK_MEMORY" }
+    filter "options:simd=avx2"
+        vectorextensions "AVX2"
+    filter {}
+
     -- Output Folder Pattern: Debug-Windows-x64
     outputdir = "%{cfg.buildcfg}-%{cfg.system}-%{cfg.architecture}"
 
@@ -58,6 +78,7 @@ workspace "YamenEngine"
     group "Yamen/Application"
         include "Client"
         include "Tools"
+        include "Benchmarks"
     group ""
 
     -- ============================================================